@@ -20,36 +20,75 @@
 using namespace std;
 
 typedef uint8_t     data_t;
-typedef uint16_t    code_t;
+typedef uint32_t    code_t;
 
 typedef vector<data_t>  data_stream_t;
 typedef vector<code_t>  code_stream_t;
 
-template <int reference_size = 16, int coding_size = 17>
+/**
+ *  コード幅(最大32bit)を格納できる最小の型
+ */
+template <int width, bool narrow = (width <= 16)>
+struct CodeType {
+    typedef uint16_t    type;
+};
+
+template <int width>
+struct CodeType<width, false> {
+    typedef uint32_t    type;
+};
+
+template <
+    int reference_size  = 16,
+    int coding_size     = 17,
+    typename code_type  = typename CodeType<
+                            Log2<reference_size>::value + Log2<coding_size - 1>::value + 1
+                          >::type
+>
 class Lzss {
 public:
+    typedef code_type           code_t;
+    typedef vector<code_t>      code_stream_t;
+
     static const int    window_size = reference_size + coding_size;
     static const int    code_width  = Log2<reference_size >::value
                                     + Log2<coding_size - 1>::value
                                     + 1;
+    //  ヒープを使わない小メッセージ用エンコードの閾値
+    static const int    small_message_size  = 256;
+
+    /**
+     *  @param  length_extension    一致長延長の有効化
+     *          最大長(coding_size)の一致コードの後に、追加一致長を示す延長コード
+     *          ({1, 追加長})を付加する。追加長が最大値の場合はさらに延長コードが続く。
+     *  @param  early_literals      早期リテラル数
+     *          先頭early_literalsバイトは検索せずにリテラルとする(lzss_enc_topのpEarlyLiterals)。
+     */
+    Lzss(bool length_extension = false, int early_literals = 0) :
+        length_extension(length_extension),
+        early_literals  (early_literals)
+    {}
 
     code_stream_t*  encode(data_stream_t* input_stream);
+    int             encode(const data_t* input, int size, code_t* output);
     data_stream_t*  decode(code_stream_t* input_stream);
 
     void clear();
 
 protected:
+    const bool      length_extension;
+    const int       early_literals;
     data_stream_t   buffer;
 
     int compare(int offset, int ref_size);
 
 };
 
-template <int reference_size, int coding_size>
-code_stream_t* Lzss<reference_size, coding_size>::encode(data_stream_t* input_stream) {
+template <int reference_size, int coding_size, typename code_type>
+typename Lzss<reference_size, coding_size, code_type>::code_stream_t*
+Lzss<reference_size, coding_size, code_type>::encode(data_stream_t* input_stream) {
     code_stream_t*          output_stream   = new code_stream_t;
     data_stream_t::iterator pos             = input_stream->begin();
-    bool                    input_done      = false;
     int                     total_size      = 0;
     int                     ref_size        = 0;
     int                     offset;
@@ -58,15 +97,30 @@ code_stream_t* Lzss<reference_size, coding_size>::encode(data_stream_t* input_st
     int                     max_length;
     code_t                  code;
 
+    //  小メッセージはスタック上で処理
+    if (input_stream->size() < small_message_size) {
+        code_t  codes[small_message_size];
+        int     code_size   = 0;
+        if (!input_stream->empty()) {
+            code_size   = encode(&input_stream->at(0), input_stream->size(), codes);
+        }
+        output_stream->assign(codes, codes + code_size);
+        return output_stream;
+    }
+
+    //  一致長延長/早期リテラル時は入力全体を直接参照して処理
+    if (length_extension || (early_literals > 0)) {
+        output_stream->resize(input_stream->size());
+        output_stream->resize(encode(&input_stream->at(0), input_stream->size(), &output_stream->at(0)));
+        return output_stream;
+    }
+
     for (int i = 0;i < coding_size;i++) {
         buffer.push_back(*pos);
         ++pos;
     }
     while (1) {
         //  最長一致系列の検索
-        if (!input_done) {
-            ref_size    = buffer.size() - coding_size;
-        }
         max_offset  = 0;
         max_length  = 0;
         length      = 0;
@@ -79,7 +133,7 @@ code_stream_t* Lzss<reference_size, coding_size>::encode(data_stream_t* input_st
         }
 
         if (max_length > 1) {
-            code     = (1 << (code_width - 1));
+            code     = ((code_t)1 << (code_width - 1));
             code    |= (max_offset << Log2<coding_size - 1>::value);
             code    |= max_length - 2;
         }
@@ -90,19 +144,17 @@ code_stream_t* Lzss<reference_size, coding_size>::encode(data_stream_t* input_st
         output_stream->push_back(code);
 
         //  次のループへの処理
+        //  参照部は入力の終端でも縮めない(LzssEncと同じく符号化位置の直前reference_size分)
         total_size  += max_length;
         for (int i = 0;i < max_length;i++) {
             if (pos != input_stream->end()) {
                 buffer.push_back(*pos);
                 ++pos;
             }
-            if (pos == input_stream->end()) {
-                input_done  = true;
-            }
-            if ((ref_size < reference_size) && (!input_done)) {
+            if (ref_size < reference_size) {
                 ref_size    += 1;
             }
-            if ((buffer.size() > window_size) || input_done) {
+            else {
                 buffer.erase(buffer.begin());
             }
         }
@@ -114,18 +166,104 @@ code_stream_t* Lzss<reference_size, coding_size>::encode(data_stream_t* input_st
     return output_stream;
 }
 
-template <int reference_size, int coding_size>
-data_stream_t* Lzss<reference_size, coding_size>::decode(code_stream_t* input_stream) {
-    data_stream_t*          output_stream   = new data_stream_t;
-    code_stream_t::iterator pos             = input_stream->begin();
-    const code_t            mask1           = 1 << (code_width - 1);
-    const code_t            mask2           = mask1 - 1;
-    int                     total_size      = 0;
-    bool                    flag;
-    code_t                  code;
-    data_t                  data;
-    int                     offset;
-    int                     length;
+/**
+ *  入力を呼び出し元のメモリ上で直接参照し、コードを呼び出し元のバッファへ出力する。
+ *  ヒープ確保も要素の削除も行わない。outputにはsize個分の領域が必要。
+ *  出力はencode(data_stream_t*)と同一。
+ *  @return 出力コード数
+ */
+template <int reference_size, int coding_size, typename code_type>
+int Lzss<reference_size, coding_size, code_type>::encode(const data_t* input, int size, code_t* output) {
+    const code_t    extension_max   = ((code_t)1 << (code_width - 1)) - 1;
+    int             head            = 0;
+    int             tail            = (size < coding_size) ? size : coding_size;
+    int             total_size      = 0;
+    int             code_size       = 0;
+    int             ref_size        = 0;
+    int             lookahead;
+    int             length;
+    int             max_offset;
+    int             max_length;
+    int             position;
+    int             distance;
+    code_t          code;
+
+    while (total_size < size) {
+        //  最長一致系列の検索
+        lookahead   = tail - head - ref_size;
+        max_offset  = 0;
+        max_length  = 0;
+        for (int offset = 0;offset < ref_size;offset++) {
+            const data_t*   d1  = input + head + offset;
+            const data_t*   d2  = input + head + ref_size;
+            for (length = 0;length < lookahead;length++) {
+                if (d1[length] != d2[length]) {
+                    break;
+                }
+            }
+            if (length >= max_length) {
+                max_length  = length;
+                max_offset  = reference_size - ref_size + offset;
+            }
+        }
+
+        if ((max_length > 1) && (total_size >= early_literals)) {
+            code     = ((code_t)1 << (code_width - 1));
+            code    |= (max_offset << Log2<coding_size - 1>::value);
+            code    |= max_length - 2;
+        }
+        else {
+            max_length  = 1;
+            code        = input[head + ref_size];
+        }
+        output[code_size++] = code;
+
+        //  一致長の延長
+        if (length_extension && (max_length == coding_size)) {
+            position    = head + ref_size;
+            distance    = reference_size - max_offset;
+            do {
+                code    = 0;
+                while ((code < extension_max) && ((position + max_length) < size) &&
+                       (input[position + max_length] == input[position + max_length - distance])) {
+                    code        += 1;
+                    max_length  += 1;
+                }
+                output[code_size++] = ((code_t)1 << (code_width - 1)) | code;
+            } while (code == extension_max);
+        }
+
+        //  次のループへの処理
+        total_size  += max_length;
+        for (int i = 0;i < max_length;i++) {
+            if (tail != size) {
+                tail    += 1;
+            }
+            if (ref_size < reference_size) {
+                ref_size    += 1;
+            }
+            else {
+                head    += 1;
+            }
+        }
+    }
+
+    return code_size;
+}
+
+template <int reference_size, int coding_size, typename code_type>
+data_stream_t* Lzss<reference_size, coding_size, code_type>::decode(code_stream_t* input_stream) {
+    data_stream_t*                      output_stream   = new data_stream_t;
+    typename code_stream_t::iterator    pos             = input_stream->begin();
+    const code_t                        mask1           = (code_t)1 << (code_width - 1);
+    const code_t                        mask2           = mask1 - 1;
+    int                                 total_size      = 0;
+    bool                                flag;
+    code_t                              code;
+    data_t                              data;
+    int                                 offset;
+    int                                 length;
+    bool                                extend;
 
     buffer.assign(reference_size, 0);
     while (pos != input_stream->end()) {
@@ -142,6 +280,23 @@ data_stream_t* Lzss<reference_size, coding_size>::decode(code_stream_t* input_st
                 output_stream->push_back(data);
                 buffer.push_back(data);
             }
+
+            //  一致長の延長
+            extend  = length_extension && (length == coding_size);
+            while (extend && (pos != input_stream->end())) {
+                if (buffer.size() > reference_size) {
+                    buffer.erase(buffer.begin(), buffer.end() - reference_size);
+                }
+                code    = (*pos) & mask2;
+                ++pos;
+                for (code_t i = 0;i < code;i++) {
+                    data    = (data_t)buffer.at(i + offset);
+                    output_stream->push_back(data);
+                    buffer.push_back(data);
+                }
+                length  += code;
+                extend  = (code == mask2);
+            }
         }
         else {
             length  = 1;
@@ -150,8 +305,8 @@ data_stream_t* Lzss<reference_size, coding_size>::decode(code_stream_t* input_st
             buffer.push_back(data);
         }
 
-        while (buffer.size() > reference_size) {
-            buffer.erase(buffer.begin());
+        if (buffer.size() > reference_size) {
+            buffer.erase(buffer.begin(), buffer.end() - reference_size);
         }
         total_size  += length;
     }
@@ -159,13 +314,13 @@ data_stream_t* Lzss<reference_size, coding_size>::decode(code_stream_t* input_st
     return output_stream;
 }
 
-template <int reference_size, int coding_size>
-void Lzss<reference_size, coding_size>::clear() {
+template <int reference_size, int coding_size, typename code_type>
+void Lzss<reference_size, coding_size, code_type>::clear() {
     buffer.clear();
 }
 
-template <int reference_size, int coding_size>
-int Lzss<reference_size, coding_size>::compare(int offset, int ref_size) {
+template <int reference_size, int coding_size, typename code_type>
+int Lzss<reference_size, coding_size, code_type>::compare(int offset, int ref_size) {
     int     length  = 0;
     int     size;
     data_t  d1, d2;
@@ -0,0 +1,283 @@
+/**
+ *  @file   lzss_factory.h
+ *  @brief  実行時パラメータ指定によるLzssの生成
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_FACTORY_H_
+#define LZSS_FACTORY_H_
+
+#include <vector>
+#include <stdint.h>
+#include "utility.h"
+#include "lzss.h"
+
+using namespace std;
+
+/**
+ *  実行時に選択されるLzssの共通インターフェース
+ */
+class LzssCodec {
+public:
+    virtual ~LzssCodec() {}
+
+    virtual int reference_size() const = 0;
+    virtual int coding_size() const = 0;
+    virtual int code_width() const = 0;
+
+    virtual code_stream_t*  encode(data_stream_t* input_stream) = 0;
+    virtual data_stream_t*  decode(code_stream_t* input_stream) = 0;
+
+    virtual void clear() = 0;
+};
+
+/**
+ *  コンパイル時パラメータのLzssをそのまま呼び出すラッパ
+ */
+template <int reference_size_value, int coding_size_value>
+class LzssCodecImpl :
+    public  LzssCodec
+{
+    typedef Lzss<reference_size_value, coding_size_value, code_t>   lzss_t;
+
+public:
+    LzssCodecImpl(bool length_extension = false) :
+        lzss    (length_extension)
+    {}
+
+    int reference_size() const {
+        return reference_size_value;
+    }
+
+    int coding_size() const {
+        return coding_size_value;
+    }
+
+    int code_width() const {
+        return lzss_t::code_width;
+    }
+
+    code_stream_t* encode(data_stream_t* input_stream) {
+        return lzss.encode(input_stream);
+    }
+
+    data_stream_t* decode(code_stream_t* input_stream) {
+        return lzss.decode(input_stream);
+    }
+
+    void clear() {
+        lzss.clear();
+    }
+
+protected:
+    lzss_t  lzss;
+};
+
+/**
+ *  実行時パラメータ版の汎用Lzss
+ *  出力はLzss<reference_size, coding_size>と同一。
+ */
+class LzssRuntime :
+    public  LzssCodec
+{
+public:
+    LzssRuntime(int reference_size_value, int coding_size_value, bool length_extension = false) :
+        reference_size_value(reference_size_value),
+        coding_size_value   (coding_size_value),
+        offset_width        (log2_ceil(reference_size_value)),
+        length_width        (log2_ceil(coding_size_value - 1)),
+        length_extension    (length_extension)
+    {}
+
+    int reference_size() const {
+        return reference_size_value;
+    }
+
+    int coding_size() const {
+        return coding_size_value;
+    }
+
+    int code_width() const {
+        return offset_width + length_width + 1;
+    }
+
+    code_stream_t*  encode(data_stream_t* input_stream);
+    data_stream_t*  decode(code_stream_t* input_stream);
+
+    void clear() {}
+
+protected:
+    const int   reference_size_value;
+    const int   coding_size_value;
+    const int   offset_width;
+    const int   length_width;
+    const bool  length_extension;
+};
+
+inline code_stream_t* LzssRuntime::encode(data_stream_t* input_stream) {
+    code_stream_t*  output_stream   = new code_stream_t;
+    const data_t*   input           = (input_stream->empty()) ? 0 : &input_stream->at(0);
+    const int       size            = input_stream->size();
+    const code_t    extension_max   = ((code_t)1 << (code_width() - 1)) - 1;
+    int             head            = 0;
+    int             tail            = (size < coding_size_value) ? size : coding_size_value;
+    int             total_size      = 0;
+    int             ref_size        = 0;
+    int             lookahead;
+    int             length;
+    int             max_offset;
+    int             max_length;
+    int             position;
+    int             distance;
+    code_t          code;
+
+    output_stream->reserve(size);
+    while (total_size < size) {
+        //  最長一致系列の検索
+        lookahead   = tail - head - ref_size;
+        max_offset  = 0;
+        max_length  = 0;
+        for (int offset = 0;offset < ref_size;offset++) {
+            const data_t*   d1  = input + head + offset;
+            const data_t*   d2  = input + head + ref_size;
+            for (length = 0;length < lookahead;length++) {
+                if (d1[length] != d2[length]) {
+                    break;
+                }
+            }
+            if (length >= max_length) {
+                max_length  = length;
+                max_offset  = reference_size_value - ref_size + offset;
+            }
+        }
+
+        if (max_length > 1) {
+            code     = ((code_t)1 << (code_width() - 1));
+            code    |= (max_offset << length_width);
+            code    |= max_length - 2;
+        }
+        else {
+            max_length  = 1;
+            code        = input[head + ref_size];
+        }
+        output_stream->push_back(code);
+
+        //  一致長の延長
+        if (length_extension && (max_length == coding_size_value)) {
+            position    = head + ref_size;
+            distance    = reference_size_value - max_offset;
+            do {
+                code    = 0;
+                while ((code < extension_max) && ((position + max_length) < size) &&
+                       (input[position + max_length] == input[position + max_length - distance])) {
+                    code        += 1;
+                    max_length  += 1;
+                }
+                output_stream->push_back(((code_t)1 << (code_width() - 1)) | code);
+            } while (code == extension_max);
+        }
+
+        //  次のループへの処理
+        total_size  += max_length;
+        for (int i = 0;i < max_length;i++) {
+            if (tail != size) {
+                tail    += 1;
+            }
+            if (ref_size < reference_size_value) {
+                ref_size    += 1;
+            }
+            else {
+                head    += 1;
+            }
+        }
+    }
+
+    return output_stream;
+}
+
+inline data_stream_t* LzssRuntime::decode(code_stream_t* input_stream) {
+    data_stream_t*  output_stream   = new data_stream_t;
+    const code_t    mask1           = (code_t)1 << (code_width() - 1);
+    const code_t    mask2           = mask1 - 1;
+    bool            flag;
+    code_t          code;
+    int             offset;
+    int             length;
+    int             base;
+    bool            extend;
+
+    for (code_stream_t::iterator pos = input_stream->begin();pos != input_stream->end();++pos) {
+        //  入力コードの取りだし
+        flag    = ((*pos) & mask1) ? true : false;
+        code    =  (*pos) & mask2;
+
+        if (flag) {
+            //  参照バッファは出力済みデータの末尾reference_size分(不足分は0)
+            offset  = (code >> length_width) & ((1 << offset_width) - 1);
+            length  = (code & ((1 << length_width) - 1)) + 2;
+            base    = (int)output_stream->size() - reference_size_value + offset;
+            for (int i = 0;i < length;i++) {
+                output_stream->push_back((base + i < 0) ? 0 : output_stream->at(base + i));
+            }
+
+            //  一致長の延長
+            extend  = length_extension && (length == coding_size_value);
+            while (extend && ((pos + 1) != input_stream->end())) {
+                ++pos;
+                code    = (*pos) & mask2;
+                base    = (int)output_stream->size() - reference_size_value + offset;
+                for (code_t i = 0;i < code;i++) {
+                    output_stream->push_back((base + (int)i < 0) ? 0 : output_stream->at(base + i));
+                }
+                extend  = (code == mask2);
+            }
+        }
+        else {
+            output_stream->push_back((data_t)code);
+        }
+    }
+
+    return output_stream;
+}
+
+/**
+ *  パラメータに対応するLzssを生成する。
+ *  事前にインスタンス化された組み合わせはLzss<R, C>を、
+ *  それ以外はLzssRuntimeを使用する。
+ *  @return 生成したLzss(コード幅が不正な場合は0)
+ */
+inline LzssCodec* create_lzss(int reference_size, int coding_size, bool length_extension = false) {
+#define LZSS_CODEC_ENTRY(r, c) \
+    if ((reference_size == r) && (coding_size == c)) {\
+        return new LzssCodecImpl<r, c>(length_extension);\
+    }
+
+    LZSS_CODEC_ENTRY(  16, 17)  LZSS_CODEC_ENTRY(  16, 33)
+    LZSS_CODEC_ENTRY(  32,  9)  LZSS_CODEC_ENTRY(  32, 17)  LZSS_CODEC_ENTRY(  32, 33)
+    LZSS_CODEC_ENTRY(  64,  5)  LZSS_CODEC_ENTRY(  64,  9)  LZSS_CODEC_ENTRY(  64, 17)  LZSS_CODEC_ENTRY(  64, 33)
+    LZSS_CODEC_ENTRY( 128,  3)  LZSS_CODEC_ENTRY( 128,  5)  LZSS_CODEC_ENTRY( 128,  9)  LZSS_CODEC_ENTRY( 128, 17)  LZSS_CODEC_ENTRY( 128, 33)
+    LZSS_CODEC_ENTRY( 256,  3)  LZSS_CODEC_ENTRY( 256,  5)  LZSS_CODEC_ENTRY( 256,  9)  LZSS_CODEC_ENTRY( 256, 17)  LZSS_CODEC_ENTRY( 256, 33)
+    LZSS_CODEC_ENTRY( 512,  3)  LZSS_CODEC_ENTRY( 512,  5)  LZSS_CODEC_ENTRY( 512,  9)  LZSS_CODEC_ENTRY( 512, 17)  LZSS_CODEC_ENTRY( 512, 33)
+    LZSS_CODEC_ENTRY(1024,  3)  LZSS_CODEC_ENTRY(1024,  5)  LZSS_CODEC_ENTRY(1024,  9)  LZSS_CODEC_ENTRY(1024, 17)  LZSS_CODEC_ENTRY(1024, 33)
+    LZSS_CODEC_ENTRY(2048,  3)  LZSS_CODEC_ENTRY(2048,  5)  LZSS_CODEC_ENTRY(2048,  9)  LZSS_CODEC_ENTRY(2048, 17)  LZSS_CODEC_ENTRY(2048, 33)
+    LZSS_CODEC_ENTRY(4096,  3)  LZSS_CODEC_ENTRY(4096,  5)  LZSS_CODEC_ENTRY(4096,  9)  LZSS_CODEC_ENTRY(4096, 17)  LZSS_CODEC_ENTRY(4096, 33)
+
+#undef LZSS_CODEC_ENTRY
+
+    //  リテラル(データ幅+フラグ)がコードに収まり、かつcode_tに収まること
+    LzssRuntime*    lzss    = new LzssRuntime(reference_size, coding_size, length_extension);
+    if ((reference_size < 2) || (coding_size < 3) ||
+        (lzss->code_width() < 9) || (lzss->code_width() > (int)(sizeof(code_t) * 8))) {
+        delete lzss;
+        return 0;
+    }
+    return lzss;
+}
+
+#endif /* LZSS_FACTORY_H_ */
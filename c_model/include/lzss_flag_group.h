@@ -0,0 +1,126 @@
+/**
+ *  @file   lzss_flag_group.h
+ *  @brief  バイト境界フラググループ形式
+ *
+ *  8コード分の一致フラグを1byteの制御バイトにまとめ、その後に
+ *  リテラル(1byte)/一致コード(16bit, リトルエンディアン)を並べる形式。
+ *  一致コードは{オフセット, 一致長 - 2}、延長コードは追加一致長を16bitで格納する。
+ *  コード幅が17bit以下(オフセット幅 + 一致長幅が16bit以下)の場合に使用可能。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_FLAG_GROUP_H_
+#define LZSS_FLAG_GROUP_H_
+
+#include <vector>
+#include <stdint.h>
+#include "utility.h"
+#include "lzss.h"
+
+using namespace std;
+
+static const int    flag_group_max_code_width   = 17;
+
+/**
+ *  パック形式のコード列をフラググループ形式に変換する
+ *  @return 変換結果(コード幅が大きすぎる場合は0)
+ */
+template <typename T>
+data_stream_t* encode_flag_group(vector<T>* code_stream, int code_width) {
+    data_stream_t*  output_stream;
+    const T         mask1           = (T)1 << (code_width - 1);
+    const T         mask2           = mask1 - 1;
+    size_t          control_pos     = 0;
+    T               code;
+
+    if (code_width > flag_group_max_code_width) {
+        return 0;
+    }
+
+    output_stream   = new data_stream_t;
+    output_stream->reserve(code_stream->size() * 2 + code_stream->size() / 8 + 1);
+    for (size_t i = 0;i < code_stream->size();i++) {
+        //  制御バイト
+        if ((i % 8) == 0) {
+            control_pos = output_stream->size();
+            output_stream->push_back(0);
+        }
+
+        code    = (*code_stream)[i];
+        if (code & mask1) {
+            (*output_stream)[control_pos]   |= (data_t)(1 << (i % 8));
+            output_stream->push_back((data_t)(((code & mask2) >> 0) & 0xff));
+            output_stream->push_back((data_t)(((code & mask2) >> 8) & 0xff));
+        }
+        else {
+            output_stream->push_back((data_t)code);
+        }
+    }
+
+    return output_stream;
+}
+
+/**
+ *  フラググループ形式を復号する
+ *  参照バッファは出力データ自身を使用する(先頭より前は0)。
+ */
+inline data_stream_t* decode_flag_group(
+    data_stream_t*  input_stream,
+    int             reference_size,
+    int             coding_size,
+    bool            length_extension = false
+) {
+    data_stream_t*  output_stream   = new data_stream_t;
+    const int       length_width    = log2_ceil(coding_size - 1);
+    const int       length_mask     = (1 << length_width) - 1;
+    const int       extension_max   = (1 << (log2_ceil(reference_size) + length_width)) - 1;
+    const data_t*   input           = (input_stream->empty()) ? 0 : &input_stream->at(0);
+    const size_t    size            = input_stream->size();
+    size_t          pos             = 0;
+    int             control;
+    int             word;
+    int             distance        = 0;
+    int             length;
+    int             source;
+    bool            extend          = false;
+
+    output_stream->reserve(size * 2);
+    while (pos < size) {
+        control = input[pos++];
+        for (int bit = 0;(bit < 8) && (pos < size);bit++, control >>= 1) {
+            //  リテラル
+            if ((control & 0x1) == 0) {
+                output_stream->push_back(input[pos++]);
+                continue;
+            }
+
+            //  一致コード/延長コード
+            word    = input[pos] | (input[pos + 1] << 8);
+            pos     += 2;
+            if (extend) {
+                length  = word;
+                extend  = (word == extension_max);
+            }
+            else {
+                distance    = reference_size - (word >> length_width);
+                length      = (word & length_mask) + 2;
+                extend      = length_extension && (length == coding_size);
+            }
+
+            source  = (int)output_stream->size() - distance;
+            for (int i = 0;i < length;i++, source++) {
+                output_stream->push_back((source < 0) ? 0 : (*output_stream)[source]);
+            }
+        }
+    }
+
+    return output_stream;
+}
+
+#endif /* LZSS_FLAG_GROUP_H_ */
@@ -0,0 +1,156 @@
+/**
+ *  @file   lzss_hash.h
+ *  @brief  ハッシュ索引によるLZSSエンコード(rtl/lzss_enc_hash_top.vと同一の方針)
+ *
+ *  先頭2データのハッシュ((d0 << 4) ^ d1、最後のデータはd1 = 0)ごとに
+ *  直近candidates個の位置を保持し、符号化位置ではその候補とのみ一致比較する。
+ *  位置はフレーム先頭からの位置をlog2(reference_size) + 1ビットで数え、
+ *  距離(位置の差)が1～reference_sizeの候補を有効とする。
+ *  同じ一致長の候補は新しい位置を選択する。
+ *  ハッシュテーブルへの登録は一致コードで読み飛ばす位置も含めて全位置で行う。
+ *  デコードはLzssと共通。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_HASH_H_
+#define LZSS_HASH_H_
+
+#include <vector>
+#include <stdint.h>
+#include "utility.h"
+#include "lzss.h"
+
+using namespace std;
+
+template <
+    int reference_size  = 1024,
+    int coding_size     = 17,
+    int hash_width      = 10,
+    int candidates      = 2,
+    typename code_type  = typename CodeType<
+                            Log2<reference_size>::value + Log2<coding_size - 1>::value + 1
+                          >::type
+>
+class LzssHash :
+    public  Lzss<reference_size, coding_size, code_type>
+{
+    typedef Lzss<reference_size, coding_size, code_type>    lzss_t;
+
+public:
+    typedef typename lzss_t::code_t         code_t;
+    typedef typename lzss_t::code_stream_t  code_stream_t;
+
+    static const int    code_width      = lzss_t::code_width;
+    static const int    hash_size       = 1 << hash_width;
+    static const int    position_mask   = (1 << (Log2<reference_size>::value + 1)) - 1;
+
+    LzssHash() :
+        lzss_t  (false)
+    {}
+
+    code_stream_t*  encode(data_stream_t* input_stream);
+    int             encode(const data_t* input, int size, code_t* output);
+
+protected:
+    //  ハッシュごとの候補位置(先頭が最新, 負の値は無効)
+    vector<int> head;
+
+    void insert(int hash, int position);
+};
+
+template <int reference_size, int coding_size, int hash_width, int candidates, typename code_type>
+typename LzssHash<reference_size, coding_size, hash_width, candidates, code_type>::code_stream_t*
+LzssHash<reference_size, coding_size, hash_width, candidates, code_type>::encode(data_stream_t* input_stream) {
+    code_stream_t*  output_stream   = new code_stream_t;
+
+    if (!input_stream->empty()) {
+        output_stream->resize(input_stream->size());
+        output_stream->resize(encode(&input_stream->at(0), input_stream->size(), &output_stream->at(0)));
+    }
+
+    return output_stream;
+}
+
+/**
+ *  outputにはsize個分の領域が必要。
+ *  @return 出力コード数
+ */
+template <int reference_size, int coding_size, int hash_width, int candidates, typename code_type>
+int LzssHash<reference_size, coding_size, hash_width, candidates, code_type>::encode(const data_t* input, int size, code_t* output) {
+    int     code_size   = 0;
+    int     skip        = 0;
+    int     hash;
+    int     distance;
+    int     length;
+    int     lookahead;
+    int     max_distance;
+    int     max_length;
+    code_t  code;
+
+    head.assign(hash_size * candidates, -1);
+    for (int position = 0;position < size;position++) {
+        hash    = input[position] << 4;
+        if ((position + 1) < size) {
+            hash    ^= input[position + 1];
+        }
+        hash    &= hash_size - 1;
+
+        //  符号化位置のみ候補と比較(同じ一致長は新しい候補)
+        if (skip == 0) {
+            lookahead       = ((size - position) < coding_size) ? (size - position) : coding_size;
+            max_distance    = 0;
+            max_length      = 0;
+            for (int i = 0;i < candidates;i++) {
+                if (head[hash * candidates + i] < 0) {
+                    continue;
+                }
+                distance    = (position - head[hash * candidates + i]) & position_mask;
+                if ((distance == 0) || (distance > reference_size)) {
+                    continue;
+                }
+                for (length = 0;length < lookahead;length++) {
+                    if (input[position - distance + length] != input[position + length]) {
+                        break;
+                    }
+                }
+                if (length > max_length) {
+                    max_distance    = distance;
+                    max_length      = length;
+                }
+            }
+
+            if (max_length > 1) {
+                code     = ((code_t)1 << (code_width - 1));
+                code    |= ((reference_size - max_distance) << Log2<coding_size - 1>::value);
+                code    |= max_length - 2;
+                skip     = max_length;
+            }
+            else {
+                code     = input[position];
+                skip     = 1;
+            }
+            output[code_size++] = code;
+        }
+        skip    -= 1;
+
+        insert(hash, position & position_mask);
+    }
+
+    return code_size;
+}
+
+template <int reference_size, int coding_size, int hash_width, int candidates, typename code_type>
+void LzssHash<reference_size, coding_size, hash_width, candidates, code_type>::insert(int hash, int position) {
+    for (int i = candidates - 1;i > 0;i--) {
+        head[hash * candidates + i] = head[hash * candidates + i - 1];
+    }
+    head[hash * candidates] = position;
+}
+
+#endif /* LZSS_HASH_H_ */
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <string>
 #include <vector>
+#include <iterator>
 
 using namespace std;
 
@@ -34,28 +35,37 @@ struct Log2<1> {
     };
 };
 
-template <int W, typename T>
-void write_file(string& file, vector<T>* output_stream) {
-    ofstream    ofs(file.c_str(), ios::binary | ios::out);
+inline int log2_ceil(int n) {
+    int value   = 0;
+    while ((1 << value) < n) {
+        value   += 1;
+    }
+    return value;
+}
+
+/**
+ *  W bit単位のデータをMSBから詰めてバイト列にする
+ */
+template <typename T>
+void pack_stream(vector<T>* input_stream, int W, vector<char>* output) {
     char        byte;
     T           data;
     int         byte_pos;
     int         data_pos;
-    int         byte_count;
 
     byte_pos    = 8;
     byte        = 0;
-    byte_count  = 0;
-    for (typename vector<T>::iterator i = output_stream->begin();i != output_stream->end();++i) {
+    output->clear();
+    output->reserve(((size_t)input_stream->size() * W + 7) / 8);
+    for (typename vector<T>::iterator i = input_stream->begin();i != input_stream->end();++i) {
         data    = *i;
 
         for (data_pos = W;data_pos > 0;data_pos--) {
             byte    |= ((data >> (data_pos - 1)) & 0x1) << (byte_pos - 1);
             if (byte_pos == 1) {
-                ofs.put(byte);
+                output->push_back(byte);
                 byte_pos    = 8;
                 byte        = 0;
-                byte_count  += 1;
             }
             else {
                 byte_pos    -= 1;
@@ -63,19 +73,15 @@ void write_file(string& file, vector<T>* output_stream) {
         }
     }
     if (byte_pos != 8) {
-        ofs.put(byte);
-        byte_count  += 1;
+        output->push_back(byte);
     }
-    ofs.close();
-
-    cout << "Write       : " << file                  << endl;
-    cout << "Output Size : " << byte_count << "bytes" << endl;
 }
 
-template <int W, typename T>
-vector<T>* read_file(string& file) {
-    vector<T>*  output  = new vector<T>;
-    ifstream    ifs(file.c_str(), ios::binary);
+/**
+ *  バイト列をW bit単位のデータに分解する(端数は破棄)
+ */
+template <typename T>
+void unpack_stream(vector<char>* input, int W, vector<T>* output_stream) {
     T           data;
     char        byte;
     int         data_pos;
@@ -83,16 +89,15 @@ vector<T>* read_file(string& file) {
 
     data_pos    = W;
     data        = 0;
-    while (1) {
-        ifs.get(byte);
-        if (ifs.eof()) {
-            break;
-        }
+    output_stream->clear();
+    output_stream->reserve((input->size() * 8) / W);
+    for (vector<char>::iterator i = input->begin();i != input->end();++i) {
+        byte    = *i;
 
         for (byte_pos = 8;byte_pos > 0;byte_pos--) {
-            data    |= ((byte >> (byte_pos - 1)) & 0x1) << (data_pos - 1);
+            data    |= (T)((byte >> (byte_pos - 1)) & 0x1) << (data_pos - 1);
             if (data_pos == 1) {
-                output->push_back(data);
+                output_stream->push_back(data);
                 data_pos    = W;
                 data        = 0;
             }
@@ -101,6 +106,30 @@ vector<T>* read_file(string& file) {
             }
         }
     }
+}
+
+template <typename T>
+void write_file(string& file, vector<T>* output_stream, int W) {
+    ofstream        ofs(file.c_str(), ios::binary | ios::out);
+    vector<char>    bytes;
+
+    pack_stream<T>(output_stream, W, &bytes);
+    if (!bytes.empty()) {
+        ofs.write(&bytes[0], bytes.size());
+    }
+    ofs.close();
+
+    cout << "Write       : " << file                    << endl;
+    cout << "Output Size : " << bytes.size() << "bytes" << endl;
+}
+
+template <typename T>
+vector<T>* read_file(string& file, int W) {
+    vector<T>*      output  = new vector<T>;
+    ifstream        ifs(file.c_str(), ios::binary);
+    vector<char>    bytes((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+
+    unpack_stream<T>(&bytes, W, output);
 
     cout << "Read        : " << file << endl;
     cout << "Input Size  : " << output->size() << "bytes" << endl;
@@ -108,4 +137,14 @@ vector<T>* read_file(string& file) {
     return output;
 }
 
+template <int W, typename T>
+void write_file(string& file, vector<T>* output_stream) {
+    write_file<T>(file, output_stream, W);
+}
+
+template <int W, typename T>
+vector<T>* read_file(string& file) {
+    return read_file<T>(file, W);
+}
+
 #endif /* UTILITY_H_ */
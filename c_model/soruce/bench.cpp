@@ -0,0 +1,169 @@
+/**
+ *  @file   bench.cpp
+ *  @brief  小メッセージエンコードのレイテンシ計測/コード形式の比較
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <time.h>
+#include "lzss.h"
+#include "lzss_factory.h"
+#include "lzss_flag_group.h"
+
+using namespace std;
+
+#define ReferenceSize   128
+#define CodingSize      5
+
+#ifndef MessageNum
+#define MessageNum      100000
+#endif
+
+#ifndef RepeatNum
+#define RepeatNum       5
+#endif
+
+typedef Lzss<ReferenceSize, CodingSize> lzss_t;
+
+static double now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void report(const char* name, vector<double>& latency) {
+    sort(latency.begin(), latency.end());
+    cout << name
+         << " p50 : " << latency[latency.size() * 50 / 100] << "ns"
+         << " p99 : " << latency[latency.size() * 99 / 100] << "ns"
+         << " max : " << latency.back()                     << "ns" << endl;
+}
+
+static void report_format(const char* name, size_t input_size, size_t output_size, double encode_ns, double decode_ns) {
+    cout << name
+         << " size : "   << output_size << "bytes (" << (100.0 * output_size / input_size) << "%)"
+         << " encode : " << (input_size * 1e3 / encode_ns) << "MB/s"
+         << " decode : " << (input_size * 1e3 / decode_ns) << "MB/s" << endl;
+}
+
+/**
+ *  パック形式とフラググループ形式の比較
+ *  パック形式の復号はLzss::decodeと、同じ参照方法(出力自身を参照)のLzssRuntime::decodeの両方を計測
+ */
+static void compare_format(string& file) {
+    data_stream_t*          input_stream    = read_file<8, data_t>(file);
+    lzss_t                  enc;
+    lzss_t                  dec;
+    LzssRuntime             runtime_dec(ReferenceSize, CodingSize);
+    lzss_t::code_stream_t*  code_stream     = 0;
+    code_stream_t           wide_code_stream;
+    data_stream_t*          output_stream   = 0;
+    data_stream_t*          flag_group      = 0;
+    vector<char>            packed;
+    double                  time[5]         = {1e30, 1e30, 1e30, 1e30, 1e30};
+    double                  start;
+
+    for (int i = 0;i < RepeatNum;i++) {
+        //  パック形式
+        start   = now_ns();
+        code_stream = enc.encode(input_stream);
+        pack_stream(code_stream, lzss_t::code_width, &packed);
+        time[0] = min(time[0], now_ns() - start);
+        enc.clear();
+        delete code_stream;
+
+        start   = now_ns();
+        code_stream = new lzss_t::code_stream_t;
+        unpack_stream(&packed, lzss_t::code_width, code_stream);
+        output_stream   = dec.decode(code_stream);
+        time[1] = min(time[1], now_ns() - start);
+        dec.clear();
+        delete output_stream;
+
+        start   = now_ns();
+        unpack_stream(&packed, lzss_t::code_width, &wide_code_stream);
+        output_stream   = runtime_dec.decode(&wide_code_stream);
+        time[2] = min(time[2], now_ns() - start);
+        delete output_stream;
+        delete code_stream;
+
+        //  フラググループ形式
+        start   = now_ns();
+        code_stream = enc.encode(input_stream);
+        flag_group  = encode_flag_group(code_stream, lzss_t::code_width);
+        time[3] = min(time[3], now_ns() - start);
+        enc.clear();
+        delete code_stream;
+
+        start   = now_ns();
+        output_stream   = decode_flag_group(flag_group, ReferenceSize, CodingSize);
+        time[4] = min(time[4], now_ns() - start);
+        if (*output_stream != *input_stream) {
+            cout << "Mismatch : " << file << endl;
+        }
+        delete output_stream;
+        if (i < (RepeatNum - 1)) {
+            delete flag_group;
+        }
+    }
+
+    report_format("packed     (Lzss::decode)       ", input_stream->size(), packed.size()     , time[0], time[1]);
+    report_format("packed     (LzssRuntime::decode)", input_stream->size(), packed.size()     , time[0], time[2]);
+    report_format("flag group                      ", input_stream->size(), flag_group->size(), time[3], time[4]);
+    cout << endl;
+
+    delete flag_group;
+    delete input_stream;
+}
+
+int main(int argc, char* argv[]) {
+    vector<data_stream_t>   messages(MessageNum);
+    vector<double>          vector_latency;
+    vector<double>          stack_latency;
+    lzss_t::code_t          codes[lzss_t::small_message_size];
+    lzss_t                  enc;
+    double                  start;
+
+    //  RPCメッセージを模したテキスト(終端のNULは使用しない)
+    static const char   pattern[]   = "{\"id\":0123456789,\"key\":\"value\"}";
+    srand(1);
+    for (size_t i = 0;i < messages.size();i++) {
+        int size    = lzss_t::small_message_size / 4 + rand() % (lzss_t::small_message_size * 3 / 4);
+        for (int j = 0;j < size;j++) {
+            messages[i].push_back(pattern[rand() % (sizeof(pattern) - 1)]);
+        }
+    }
+
+    for (size_t i = 0;i < messages.size();i++) {
+        start   = now_ns();
+        lzss_t::code_stream_t*  code_stream = enc.encode(&messages[i]);
+        delete code_stream;
+        vector_latency.push_back(now_ns() - start);
+        enc.clear();
+
+        start   = now_ns();
+        enc.encode(&messages[i][0], messages[i].size(), codes);
+        stack_latency.push_back(now_ns() - start);
+    }
+
+    report("encode(data_stream_t*)        ", vector_latency);
+    report("encode(const data_t*, code_t*)", stack_latency );
+    cout << endl;
+
+    //  引数で指定したファイルでコード形式を比較
+    for (int i = 1;i < argc;i++) {
+        string  file    = argv[i];
+        compare_format(file);
+    }
+
+    return 0;
+}
@@ -13,14 +13,14 @@
 #include <iostream>
 #include <cstdlib>
 #include "lzss.h"
+#include "lzss_factory.h"
+#include "lzss_flag_group.h"
 
 using namespace std;
 
 #define ReferenceSize   128
 #define CodingSize      5
 
-typedef Lzss<ReferenceSize, CodingSize> lzss_t;
-
 int main(int argc, char* argv[]) {
     string          data_in;
     string          code_out;
@@ -29,18 +29,59 @@ int main(int argc, char* argv[]) {
     data_stream_t*  data_in_stream;
     code_stream_t*  code_out_stream;
     data_stream_t*  data_out_stream;
-    lzss_t          enc;
-    lzss_t          dec;
+    data_stream_t*  flag_group_stream;
+    LzssCodec*      enc;
+    LzssCodec*      dec;
+    int             reference_size  = ReferenceSize;
+    int             coding_size     = CodingSize;
+    bool            length_extension    = false;
+    bool            flag_group          = false;
+    int             i;
+
+    //  パラメータ指定(-r 参照部サイズ -c 符号化部サイズ -e 一致長延長 -g フラググループ形式)
+    for (i = 1;i < argc;i++) {
+        if ((string(argv[i]) == "-r") && ((i + 1) < argc)) {
+            reference_size  = atoi(argv[++i]);
+        }
+        else if ((string(argv[i]) == "-c") && ((i + 1) < argc)) {
+            coding_size     = atoi(argv[++i]);
+        }
+        else if (string(argv[i]) == "-e") {
+            length_extension    = true;
+        }
+        else if (string(argv[i]) == "-g") {
+            flag_group          = true;
+        }
+        else {
+            break;
+        }
+    }
 
-    for (int i = 1;i < argc;i++) {
+    enc = create_lzss(reference_size, coding_size, length_extension);
+    dec = create_lzss(reference_size, coding_size, length_extension);
+    if ((enc == 0) || (dec == 0) || (flag_group && (enc->code_width() > flag_group_max_code_width))) {
+        cerr << "Unsupported parameter : reference size " << reference_size
+             << " coding size " << coding_size << endl;
+        return 1;
+    }
+
+    for (;i < argc;i++) {
         data_in     = string("../sample/") + string(argv[i]);
         code_out    = string("./encode/")  + string(argv[i]) + string(".bin");
         data_out    = string("./decode/")  + string(argv[i]);
 
         data_in_stream  = read_file<8, data_t>(data_in);
-        code_out_stream = enc.encode(data_in_stream);
-        data_out_stream = dec.decode(code_out_stream);
-        write_file<lzss_t::code_width, code_t>(code_out, code_out_stream);
+        code_out_stream = enc->encode(data_in_stream);
+        if (flag_group) {
+            flag_group_stream   = encode_flag_group(code_out_stream, enc->code_width());
+            data_out_stream     = decode_flag_group(flag_group_stream, reference_size, coding_size, length_extension);
+            write_file<8, data_t>(code_out, flag_group_stream);
+            delete flag_group_stream;
+        }
+        else {
+            data_out_stream     = dec->decode(code_out_stream);
+            write_file<code_t>(code_out, code_out_stream, enc->code_width());
+        }
         write_file<8, data_t>(data_out, data_out_stream);
 
         diff_command    = string("diff ") + data_in + string(" ") + data_out;
@@ -48,11 +89,14 @@ int main(int argc, char* argv[]) {
 
         cout << endl;
 
-        enc.clear();
-        dec.clear();
+        enc->clear();
+        dec->clear();
         delete data_in_stream;
         delete code_out_stream;
         delete data_out_stream;
     }
+
+    delete enc;
+    delete dec;
     return 0;
 }
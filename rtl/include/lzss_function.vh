@@ -34,3 +34,15 @@ function integer get_code_width (
         get_code_width  = 0;
     end
 endfunction
+
+function integer get_search_stages (
+    input   integer offset_width,
+    input   integer interval
+);
+    if (interval == 0) begin
+        get_search_stages   = 0;
+    end
+    else begin
+        get_search_stages   = (offset_width + interval - 1) / interval;
+    end
+endfunction
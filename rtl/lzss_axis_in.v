@@ -0,0 +1,198 @@
+/**
+ *  @file   lzss_axis_in.v
+ *  @brief  AXI4-Stream入力アダプタモジュール
+ *
+ *  pAxisBytesバイトのAXI4-Streamビート(TDATA/TKEEP/TLAST)を
+ *  エンコーダのpBytesPerCycleバイトのビート(i_keepは下位から連続)に変換する。
+ *  TKEEPが0のバイト(ヌルバイト)は詰めて除き、ビートをまたいでエンコーダのレーンを埋める。
+ *  エンコーダのビートはフレームの最後のバイトまでとし、次のフレームのバイトは次のビートにする。
+ *  全バイトがヌルのTLASTのビートでもフレームを終えられるよう、フレームの最新のバイトは
+ *  次のバイトかラストが分かるまでキューに残す。ヌルのTLASTはそのバイトのラストとし、
+ *  そのバイトを出力するまで次のビートを受け付けない(データのないフレームは無視する)。
+ *  このため、フレームの途中のエンコーダのビートはその次のバイトがキューに入るまで出力しない。
+ *  送信元がフレームの途中でTVALIDを止めると、キューに残ったバイト(最大pBytesPerCycleバイト)は
+ *  次のビートを受け付けるまでエンコーダに渡らず、その分レイテンシが増える
+ *  (フレームの最後のバイトも、TLASTが分かるまでは同様に待つ)。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_axis_in #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pDataWidth              = 8,                            //!<    データ幅
+    parameter   pAxisBytes              = 8,                            //!<    AXI4-Streamのバイト数
+    parameter   pBytesPerCycle          = 1,                            //!<    エンコーダの1サイクルの入力バイト数
+    parameter   pQueueDepth             = 2 * pAxisBytes + pBytesPerCycle,  //!<    キューの深さ
+    parameter   pAxisWidth              = pDataWidth * pAxisBytes,      //!<    TDATA幅
+    parameter   pOutputWidth            = pDataWidth * pBytesPerCycle   //!<    出力データバス幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  AXI4-Stream入力
+    input                               i_tvalid,                       //!<    TVALID
+    output                              ow_tready,                      //!<    TREADY
+    input       [pAxisWidth-1:0]        i_tdata,                        //!<    TDATA(下位バイトが先)
+    input       [pAxisBytes-1:0]        i_tkeep,                        //!<    TKEEP
+    input                               i_tlast,                        //!<    TLAST
+    //  エンコーダへのデータ出力
+    output                              o_valid,                        //!<    出力データバリッド
+    input                               i_ready,                        //!<    出力データレディ
+    output      [pOutputWidth-1:0]      o_data,                         //!<    出力データ(下位レーンが先)
+    output      [pBytesPerCycle-1:0]    o_keep,                         //!<    出力データ有効レーン
+    output                              o_last                          //!<    出力データラスト
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpEntryWidth            = pDataWidth + 1;
+    localparam  lpPositionWidth         = log2(pAxisBytes) + 1;
+    localparam  lpCountWidth            = log2(pBytesPerCycle) + 1;
+
+//--type-------+width------------------+name---------------------------+description
+    wire        [lpPositionWidth-1:0]   w_position[0:pAxisBytes];
+    wire        [pAxisBytes-1:0]        w_push_keep;
+    wire        [pAxisBytes*lpEntryWidth-1:0]
+                                        w_push_d;
+    wire                                w_in_ack;
+    wire                                w_push_ready;
+    wire                                w_null_last;
+    reg                                 r_open;
+    reg                                 r_pending_last;
+    wire        [pBytesPerCycle:0]      w_valid;
+    wire        [(pBytesPerCycle+1)*lpEntryWidth-1:0]
+                                        w_entry;
+    wire        [pBytesPerCycle-1:0]    w_pending_lane;
+    wire        [pBytesPerCycle-1:0]    w_entry_last;
+    wire        [pBytesPerCycle:0]      w_last_found;
+    wire        [pBytesPerCycle-1:0]    w_keep;
+    wire        [lpCountWidth-1:0]      w_count[0:pBytesPerCycle];
+    wire                                w_out_ack;
+    genvar                              i;
+    genvar                              j;
+
+//----------------------------------------------------------------------
+//  ヌルバイトの除去(有効バイトを下位から詰める)
+//----------------------------------------------------------------------
+    assign  w_position[0]   = {lpPositionWidth{1'b0}};
+    generate
+        for (j = 0;j < pAxisBytes;j = j + 1) begin : position_loop
+            assign  w_position[j+1] = w_position[j] + i_tkeep[j];
+        end
+
+        for (i = 0;i < pAxisBytes;i = i + 1) begin : pack_loop1
+            wire    [pAxisBytes-1:0]    w_sel;
+            wire    [pAxisWidth-1:0]    w_sel_data;
+
+            for (j = 0;j < pAxisBytes;j = j + 1) begin : pack_loop2
+                assign  w_sel[j]                                = i_tkeep[j] & (w_position[j] == i);
+                assign  w_sel_data[j*pDataWidth+:pDataWidth]    = {pDataWidth{w_sel[j]}} & i_tdata[j*pDataWidth+:pDataWidth];
+            end
+
+            //  ラストは詰めた後の最後の有効バイトに付ける
+            assign  w_push_keep[i]  = (i < w_position[pAxisBytes]) ? 1'b1 : 1'b0;
+            assign  w_push_d[i*lpEntryWidth+pDataWidth]         = i_tlast & (w_position[pAxisBytes] == (i + 1));
+            assign  w_push_d[i*lpEntryWidth+:pDataWidth]        = or_data(w_sel_data);
+        end
+    endgenerate
+
+    //  選択したバイトのOR
+    function [pDataWidth-1:0] or_data (
+        input   [pAxisWidth-1:0]    data
+    );
+        integer k;
+        begin
+            or_data = {pDataWidth{1'b0}};
+            for (k = 0;k < pAxisBytes;k = k + 1) begin
+                or_data = or_data | data[k*pDataWidth+:pDataWidth];
+            end
+        end
+    endfunction
+
+//----------------------------------------------------------------------
+//  ヌルのTLAST
+//----------------------------------------------------------------------
+    //  保留中のラストは最新のバイトを出力するまで次のビートを受け付けない
+    assign  ow_tready   = w_push_ready & (~r_pending_last);
+    assign  w_in_ack    = i_tvalid & ow_tready;
+    assign  w_null_last = w_in_ack & i_tlast & (w_position[pAxisBytes] == 0);
+
+    //  r_open : 最後に書き込んだバイトのフレームが終わっていない
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_open  <= 1'b0;
+        end
+        else if (w_in_ack && (w_position[pAxisBytes] != 0)) begin
+            r_open  <= ~i_tlast;
+        end
+        else if (w_null_last) begin
+            r_open  <= 1'b0;
+        end
+    end
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_pending_last  <= 1'b0;
+        end
+        else if (w_null_last && r_open) begin
+            r_pending_last  <= 1'b1;
+        end
+        else if (w_out_ack && (|(w_keep & w_pending_lane))) begin
+            r_pending_last  <= 1'b0;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  キュー(AXI4-Streamのビート幅 -> エンコーダのビート幅)
+//----------------------------------------------------------------------
+    //  最新のバイトの保留のため、取り出しレーンより1エントリ多く参照する
+    //  (取り出しにpBytesPerCycle + 1エントリ必要なため、深さは書き込みと取り出しが毎サイクル続く分とする)
+    lzss_enc_queue #(
+        .pWidth         (lpEntryWidth       ),
+        .pPushNum       (pAxisBytes         ),
+        .pPopNum        (pBytesPerCycle + 1 ),
+        .pDepth         (pQueueDepth        ),
+        .pPopCountWidth (lpCountWidth       )
+    ) u_queue (
+        .clk            (clk                                                ),
+        .rst_x          (rst_x                                              ),
+        .i_clear        (1'b0                                               ),
+        .i_push         (w_in_ack                                           ),
+        .o_push_ready   (w_push_ready                                       ),
+        .i_push_keep    (w_push_keep                                        ),
+        .i_push_d       (w_push_d                                           ),
+        .i_pop_count    ((w_out_ack) ? w_count[pBytesPerCycle] : {lpCountWidth{1'b0}}),
+        .o_valid        (w_valid                                            ),
+        .o_d            (w_entry                                            )
+    );
+
+//----------------------------------------------------------------------
+//  エンコーダへのデータ出力
+//----------------------------------------------------------------------
+    //  次のフレームのデータは出力しない
+    //  最新のエントリはラスト(保留中のラストを含む)の場合のみ出力する
+    assign  w_last_found[0] = 1'b0;
+    assign  w_count[0]      = {lpCountWidth{1'b0}};
+    generate
+        for (i = 0;i < pBytesPerCycle;i = i + 1) begin : out_loop
+            assign  w_pending_lane[i]                   = r_pending_last & w_valid[i] & (~w_valid[i+1]);
+            assign  w_entry_last[i]                     = w_entry[i*lpEntryWidth+pDataWidth] | w_pending_lane[i];
+            assign  o_data[i*pDataWidth+:pDataWidth]    = w_entry[i*lpEntryWidth+:pDataWidth];
+            assign  w_keep[i]                           = w_valid[i] & (w_valid[i+1] | w_entry_last[i]) & (~w_last_found[i]);
+            assign  w_last_found[i+1]                   = w_last_found[i] | (w_valid[i] & w_entry_last[i]);
+            assign  w_count[i+1]                        = w_count[i] + w_keep[i];
+        end
+    endgenerate
+
+    assign  o_keep      = w_keep;
+    assign  o_last      = |(w_keep & w_entry_last);
+    assign  o_valid     = w_keep[pBytesPerCycle-1] | o_last;
+    assign  w_out_ack   = o_valid & i_ready;
+
+endmodule
@@ -0,0 +1,144 @@
+/**
+ *  @file   lzss_axis_out.v
+ *  @brief  AXI4-Stream出力アダプタモジュール
+ *
+ *  エンコーダのコード(pCodeWidthビット、o_keepは下位から連続)を下位ビットから詰めたビット列とし、
+ *  pAxisBytesバイトのAXI4-Streamビート(TDATA/TKEEP/TLAST)で出力する。
+ *  フレームの途中は全バイト有効のビートのみを出力し、フレームの最後のビートは
+ *  残りのビットを含むバイトまでをTKEEPで示してTLASTを付ける(余りのビットは0)。
+ *  次のフレームのコードは次のビートの先頭から詰める。
+ *  前のフレームの最後のビートが残っている間は次のフレームのラストを含むコードを待たせる。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_axis_out #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pCodeWidth              = 9,                            //!<    コード幅
+    parameter   pCodesPerCycle          = 1,                            //!<    1サイクルの入力コード数
+    parameter   pAxisBytes              = 8,                            //!<    AXI4-Streamのバイト数(2のべき乗)
+    parameter   pInputWidth             = pCodeWidth * pCodesPerCycle,  //!<    入力コードバス幅
+    parameter   pAxisWidth              = 8 * pAxisBytes                //!<    TDATA幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  エンコーダからのコード入力
+    input                               i_valid,                        //!<    入力コードバリッド
+    output                              ow_ready,                       //!<    入力コードレディ
+    input       [pInputWidth-1:0]       i_code,                         //!<    入力コード(下位レーンが先)
+    input       [pCodesPerCycle-1:0]    i_keep,                         //!<    入力コード有効レーン
+    input                               i_last,                         //!<    入力コードラスト
+    //  AXI4-Stream出力
+    output                              o_tvalid,                       //!<    TVALID
+    input                               i_tready,                       //!<    TREADY
+    output      [pAxisWidth-1:0]        o_tdata,                        //!<    TDATA(下位ビットが先)
+    output      [pAxisBytes-1:0]        o_tkeep,                        //!<    TKEEP
+    output                              o_tlast                         //!<    TLAST
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpBufferWidth           = pAxisWidth * (2 + (pInputWidth + pAxisWidth - 1) / pAxisWidth);
+    localparam  lpCountWidth            = log2(lpBufferWidth) + 1;
+    localparam  lpBeatBitWidth          = log2(pAxisWidth);
+    localparam  lpCodeCountWidth        = log2(pCodesPerCycle) + 1;
+
+//--type-------+width------------------+name---------------------------+description
+    reg         [lpBufferWidth-1:0]     r_buffer;
+    reg         [lpCountWidth-1:0]      r_count;
+    reg                                 r_last_valid;
+    reg         [lpCountWidth-1:0]      r_last_count;
+    reg         [pAxisBytes-1:0]        r_last_keep;
+    wire                                w_in_ack;
+    wire                                w_out_ack;
+    wire        [lpCodeCountWidth-1:0]  w_code_count[0:pCodesPerCycle];
+    wire        [pInputWidth-1:0]       w_in_code;
+    wire        [lpCountWidth-1:0]      w_in_bits;
+    wire        [lpCountWidth-1:0]      w_rest;
+    wire        [lpCountWidth-1:0]      w_end;
+    wire        [lpCountWidth-1:0]      w_pad_end;
+    wire        [lpBeatBitWidth-1:0]    w_last_bits;
+    wire        [pAxisBytes-1:0]        w_last_keep;
+    genvar                              i;
+
+//----------------------------------------------------------------------
+//  コード入力
+//----------------------------------------------------------------------
+    //  空きが入力コード分あり、前のフレームの最後のビートが残っていない間にラストを受け付ける
+    assign  ow_ready    = (r_count <= (lpBufferWidth - pInputWidth)) & (~(r_last_valid & i_last));
+    assign  w_in_ack    = i_valid & ow_ready;
+
+    assign  w_code_count[0] = {lpCodeCountWidth{1'b0}};
+    generate
+        for (i = 0;i < pCodesPerCycle;i = i + 1) begin : code_loop
+            assign  w_code_count[i+1]                   = w_code_count[i] + i_keep[i];
+            assign  w_in_code[i*pCodeWidth+:pCodeWidth] = {pCodeWidth{w_in_ack & i_keep[i]}} & i_code[i*pCodeWidth+:pCodeWidth];
+        end
+    endgenerate
+    assign  w_in_bits   = (w_in_ack) ? w_code_count[pCodesPerCycle] * pCodeWidth : {lpCountWidth{1'b0}};
+
+//----------------------------------------------------------------------
+//  ビットバッファ
+//----------------------------------------------------------------------
+    //  出力後の残りビット数の直後に入力コードを詰める
+    assign  w_rest      = r_count - ((w_out_ack) ? pAxisWidth : 0);
+    assign  w_end       = w_rest + w_in_bits;
+
+    //  ラストはビートの境界まで0で埋める
+    assign  w_pad_end   = (w_end + (pAxisWidth - 1)) & (~(pAxisWidth - 1));
+    assign  w_last_bits = w_end[lpBeatBitWidth-1:0];
+    generate
+        for (i = 0;i < pAxisBytes;i = i + 1) begin : last_keep_loop
+            assign  w_last_keep[i]  = (w_last_bits == 0) || ((8 * i) < w_last_bits);
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_buffer    <= {lpBufferWidth{1'b0}};
+            r_count     <= {lpCountWidth{1'b0}};
+        end
+        else begin
+            r_buffer    <= (r_buffer >> ((w_out_ack) ? pAxisWidth : 0))
+                         | ({{(lpBufferWidth-pInputWidth){1'b0}}, w_in_code} << w_rest);
+            r_count     <= (w_in_ack && i_last) ? w_pad_end : w_end;
+        end
+    end
+
+    //  フレームの最後のビートの位置とTKEEP
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_last_valid    <= 1'b0;
+            r_last_count    <= {lpCountWidth{1'b0}};
+            r_last_keep     <= {pAxisBytes{1'b0}};
+        end
+        else if (w_in_ack && i_last) begin
+            r_last_valid    <= 1'b1;
+            r_last_count    <= w_pad_end;
+            r_last_keep     <= w_last_keep;
+        end
+        else if (w_out_ack && o_tlast) begin
+            r_last_valid    <= 1'b0;
+        end
+        else if (w_out_ack) begin
+            r_last_count    <= r_last_count - pAxisWidth;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  AXI4-Stream出力
+//----------------------------------------------------------------------
+    assign  o_tvalid    = (r_count >= pAxisWidth) ? 1'b1 : 1'b0;
+    assign  o_tdata     = r_buffer[pAxisWidth-1:0];
+    assign  o_tlast     = r_last_valid & (r_last_count == pAxisWidth);
+    assign  o_tkeep     = (o_tlast) ? r_last_keep : {pAxisBytes{1'b1}};
+    assign  w_out_ack   = o_tvalid & i_tready;
+
+endmodule
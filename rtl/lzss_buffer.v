@@ -2,17 +2,27 @@
  *  @file   lzss_buffer.v
  *  @brief  共通バッファモジュール
  *
+ *  pVariableShift = 0 : 上位pShiftエントリはi_dをそのまま出力し、シフトでpShiftエントリずつ取り込む。
+ *  pVariableShift = 1 : 全エントリをレジスタで持ち、シフトでi_shift_count(1～pShift)エントリずつ
+ *                       i_dの下位側から取り込む(バレルシフト)。
+ *
  *  @par    Copyright
  *  (C) 2012 Taichi Ishitani All Rights Reserved.
  *
  *  @author Taichi Ishitani
  *
  *  @date   0.0.00  2012/07/06  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     1回のシフトで複数エントリをシフトできるように変更
+ *  @date   0.0.02  2026/10/19  T. Ishitani     可変シフト(pVariableShift)追加
  */
 module lzss_buffer #(
 //--type-------+name-------------------+value--------------------------+description
     parameter   pWidth                  = 8,                            //!<    入力幅
     parameter   pDepth                  = 64,                           //!<    深さ
+    parameter   pShift                  = 1,                            //!<    1回のシフト数(入力エントリ数)
+    parameter   pVariableShift          = 0,                            //!<    可変シフト
+    parameter   pCountWidth             = log2(pShift) + 1,             //!<    シフト数幅
+    parameter   pInputWidth             = pWidth * pShift,              //!<    入力幅
     parameter   pTotalWidth             = pWidth * pDepth               //!<    出力幅
 )(
 //--type-------+width------------------+name---------------------------+description
@@ -20,21 +30,47 @@ module lzss_buffer #(
     input                               rst_x,                          //!<    非同期リセット
     input                               i_clear,                        //!<    クリア
     input                               i_shift,                        //!<    シフトイネーブル
-    input       [pWidth-1:0]            i_d,                            //!<    入力データ
+    input       [pCountWidth-1:0]       i_shift_count,                  //!<    シフト数(pVariableShift = 1のみ)
+    input       [pInputWidth-1:0]       i_d,                            //!<    入力データ(下位側が古いエントリ)
     output      [pTotalWidth-1:0]       o_d                             //!<    出力データ(pDepth分)
 );
 
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpRegisterDepth         = (pVariableShift) ? pDepth : pDepth - pShift;
+
 //--type-------+width------------------+name---------------------------+description
-    reg         [pWidth-1:0]            r_d[0:pDepth-2];
+    reg         [pWidth-1:0]            r_d[0:lpRegisterDepth-1];
     wire        [pWidth-1:0]            w_d[0:pDepth-1];
+    wire        [pTotalWidth+pInputWidth-1:0]
+                                        w_shift_d;
     genvar                              i;
 
+    //  バレルシフト用(下位側からレジスタ, 入力の順)
+    assign  w_shift_d   = {i_d, o_d};
+
     generate
         for (i = 0;i < pDepth;i = i + 1) begin : buffer_loop
             assign  o_d[i*pWidth+:pWidth]   = w_d[i];
 
-            if (i == (pDepth - 1)) begin : last
-                assign  w_d[i]  = i_d;
+            if (i >= lpRegisterDepth) begin : last
+                assign  w_d[i]  = i_d[(i-lpRegisterDepth)*pWidth+:pWidth];
+            end
+            else if (pVariableShift) begin : variable
+                assign  w_d[i]  = r_d[i];
+
+                always @(posedge clk or negedge rst_x) begin
+                    if (!rst_x) begin
+                        r_d[i]  <= {pWidth{1'b0}};
+                    end
+                    else if (i_clear) begin
+                        r_d[i]  <= {pWidth{1'b0}};
+                    end
+                    else if (i_shift) begin
+                        r_d[i]  <= w_shift_d[(i+i_shift_count)*pWidth+:pWidth];
+                    end
+                end
             end
             else begin : other
                 assign  w_d[i]  = r_d[i];
@@ -47,7 +83,7 @@ module lzss_buffer #(
                         r_d[i]  <= {pWidth{1'b0}};
                     end
                     else if (i_shift) begin
-                        r_d[i]  <= w_d[i+1];
+                        r_d[i]  <= w_d[i+pShift];
                     end
                 end
             end
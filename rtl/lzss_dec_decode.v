@@ -8,13 +8,16 @@
  *  @author Taichi Ishitani
  *
  *  @date   0.0.00  2012/06/26  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     オフセット幅がデータ幅より大きい場合に対応
  */
 module lzss_dec_decode #(
 //--type-------+name-------------------+value--------------------------+description
     parameter   pDataWidth              = 8,                            //!<    データ幅
     parameter   pCodeWidth              = 9,                            //!<    符号化部サイズ
     parameter   pOffsetWidth            = 6,                            //!<    オフセット幅
-    parameter   pLengthWidth            = 3                             //!<    一致長幅
+    parameter   pLengthWidth            = 3,                            //!<    一致長幅
+    parameter   pValueWidth             = (pDataWidth > pOffsetWidth) ? //!<    データ/オフセット幅
+                                            pDataWidth : pOffsetWidth
 )(
 //--type-------+width------------------+name---------------------------+description
     input                               clk,                            //!<    クロック
@@ -27,7 +30,7 @@ module lzss_dec_decode #(
     input                               i_ready,                        //!<    出力レディ
     output                              o_last,                         //!<    出力ラスト
     output                              o_flag,                         //!<    一致フラグ
-    output      [pDataWidth-1:0]        o_data_or_offset,               //!<    データ/オフセット
+    output      [pValueWidth-1:0]       o_data_or_offset,               //!<    データ/オフセット
     output      [pLengthWidth-1:0]      o_length                        //!<    一致長
 );
 
@@ -37,12 +40,12 @@ module lzss_dec_decode #(
     reg                                 r_valid;
     wire                                w_out_ack;
     wire                                w_flag;
-    wire        [pDataWidth-1:0]        w_data;
-    wire        [pDataWidth-1:0]        w_offset;
+    wire        [pValueWidth-1:0]       w_data;
+    wire        [pValueWidth-1:0]       w_offset;
     wire        [pLengthWidth-1:0]      w_length;
     reg                                 r_last;
     reg                                 r_flag;
-    reg         [pDataWidth-1:0]        r_data_or_offset;
+    reg         [pValueWidth-1:0]       r_data_or_offset;
     reg         [pLengthWidth-1:0]      r_length;
 
 //----------------------------------------------------------------------
@@ -107,12 +110,12 @@ module lzss_dec_decode #(
     always @(posedge clk or negedge rst_x) begin
         if (!rst_x) begin
             r_flag              <= 1'b0;
-            r_data_or_offset    <= {pDataWidth{1'b0}};
+            r_data_or_offset    <= {pValueWidth{1'b0}};
             r_length            <= {pLengthWidth{1'b0}};
         end
         else if (r_last && w_out_ack) begin
             r_flag              <= 1'b0;
-            r_data_or_offset    <= {pDataWidth{1'b0}};
+            r_data_or_offset    <= {pValueWidth{1'b0}};
             r_length            <= {pLengthWidth{1'b0}};
         end
         else if (w_in_ack) begin
@@ -0,0 +1,250 @@
+/**
+ *  @file   lzss_dec_ram_top.v
+ *  @brief  LZSSデコーダトップモジュール(RAM循環バッファ)
+ *
+ *  参照部をpReferenceSize深さのRAM(lzss_ram)の循環バッファに持つ。
+ *  出力データはアクノリッジ時に書き込みポインタの位置へ書き込み、
+ *  参照データは書き込みポインタ + オフセット(= 書き込みポインタ - 距離)の位置から読み出す。
+ *  出力データはRAMの読み出しデータ/リテラル/直前の出力データ(距離1)から選択する。
+ *  フレーム先頭より前の参照は0とする(lzss_dec_top.vと同一)。
+ *  ハンドシェイクはlzss_dec_top.vと同一。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_dec_ram_top #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pDataWidth              = 8,                            //<!    データ幅
+    parameter   pReferenceSize          = 4096,                         //<!    参照部サイズ
+    parameter   pCodingSize             = 17,                           //<!    符号化部サイズ
+    parameter   pCodeWidth              = get_code_width(               //<!    コード幅
+                                            pDataWidth,
+                                            pReferenceSize,
+                                            pCodingSize
+                                          )
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //<!    クロック
+    input                               rst_x,                          //<!    非同期リセット
+    //  コード入力
+    input                               i_valid,                        //<!    入力コードバリッド
+    output                              ow_ready,                       //<!    入力コードレディ
+    input       [pCodeWidth-1:0]        i_code,                         //<!    入力コード
+    input                               i_last,                         //<!    入力コードラスト
+    //  データ出力
+    output                              o_valid,                        //<!    出力データバリッド
+    input                               i_ready,                        //<!    出力データレディ
+    output      [pDataWidth-1:0]        o_data,                         //<!    出力データ
+    output                              o_last                          //<!    出力データラスト
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpOffsetWidth           = log2(pReferenceSize);
+    localparam  lpLengthWidth           = log2(pCodingSize) + 1;
+    localparam  lpValueWidth            = (pDataWidth > lpOffsetWidth) ? pDataWidth : lpOffsetWidth;
+    localparam  lpSizeWidth             = lpOffsetWidth + 1;
+
+//--type-------+width------------------+name---------------------------+description
+    wire                                w_valid;
+    wire                                w_ready;
+    reg                                 r_valid;
+    wire                                w_out_ack;
+    wire                                w_no_data;
+    wire                                w_last;
+    wire                                w_flag;
+    wire                                w_matched;
+    wire                                w_unmatched;
+    wire        [lpValueWidth-1:0]      w_data_or_offset;
+    wire        [lpLengthWidth-1:0]     w_length;
+    wire                                w_shift;
+    wire                                w_new_code;
+    wire                                w_last_data_done;
+    reg         [lpLengthWidth-1:0]     r_shift_count;
+    wire                                w_shift_count_ne_0;
+    wire                                w_shift_count_eq_0;
+    wire                                w_shift_count_eq_1;
+    wire        [lpOffsetWidth-1:0]     w_offset;
+    wire        [lpSizeWidth-1:0]       w_distance;
+    reg         [lpOffsetWidth-1:0]     r_write_pointer;
+    reg         [lpOffsetWidth-1:0]     r_out_address;
+    reg         [lpSizeWidth-1:0]       r_size;
+    wire        [pDataWidth-1:0]        w_ram_data;
+    reg         [pDataWidth-1:0]        r_literal;
+    reg         [pDataWidth-1:0]        r_previous_data;
+    reg                                 r_sel_ram;
+    reg                                 r_sel_previous;
+    reg                                 r_last;
+    wire        [pDataWidth-1:0]        w_data;
+
+//----------------------------------------------------------------------
+//  デコード
+//----------------------------------------------------------------------
+    lzss_dec_decode #(
+        .pDataWidth     (pDataWidth     ),
+        .pCodeWidth     (pCodeWidth     ),
+        .pOffsetWidth   (lpOffsetWidth  ),
+        .pLengthWidth   (lpLengthWidth  )
+    ) u_c_decode (
+        .clk                (clk                ),
+        .rst_x              (rst_x              ),
+        .i_valid            (i_valid            ),
+        .ow_ready           (ow_ready           ),
+        .i_code             (i_code             ),
+        .i_last             (i_last             ),
+        .o_valid            (w_valid            ),
+        .i_ready            (w_ready            ),
+        .o_last             (w_last             ),
+        .o_flag             (w_flag             ),
+        .o_data_or_offset   (w_data_or_offset   ),
+        .o_length           (w_length           )
+    );
+
+    assign  w_matched   =  w_flag;
+    assign  w_unmatched = ~w_flag;
+
+//----------------------------------------------------------------------
+//  入出力ハンドシェイク
+//----------------------------------------------------------------------
+    assign  o_valid = r_valid;
+
+    assign  w_ready     = ((w_out_ack & (w_shift_count_eq_1 | w_unmatched)) | (w_unmatched & w_no_data)) & (~r_last);
+    assign  w_out_ack   = r_valid & i_ready;
+    assign  w_no_data   = ~r_valid;
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_valid <= 1'b0;
+        end
+        else if (w_new_code) begin
+            r_valid <= 1'b1;
+        end
+        else if (w_out_ack && w_shift_count_eq_0) begin
+            r_valid <= 1'b0;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  出力タイミング制御
+//----------------------------------------------------------------------
+    assign  w_new_code          = (w_no_data | (w_shift_count_eq_0 & w_out_ack)) & w_valid;
+    assign  w_shift             = w_new_code | (w_out_ack & w_shift_count_ne_0);
+    assign  w_last_data_done    = w_out_ack & r_last;
+
+    assign  w_shift_count_ne_0  = |r_shift_count;
+    assign  w_shift_count_eq_0  = ~w_shift_count_ne_0;
+    assign  w_shift_count_eq_1  = (~|r_shift_count[lpLengthWidth-1:1]) & r_shift_count[0];
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_shift_count   <= {lpLengthWidth{1'b0}};
+        end
+        else if (w_new_code) begin
+            r_shift_count   <= w_length;
+        end
+        else if (w_out_ack && w_shift_count_ne_0) begin
+            r_shift_count   <= r_shift_count + {lpLengthWidth{1'b1}};
+        end
+    end
+
+//----------------------------------------------------------------------
+//  参照データ(循環バッファ)
+//----------------------------------------------------------------------
+    assign  w_offset    = w_data_or_offset[lpOffsetWidth-1:0];
+    assign  w_distance  = pReferenceSize - w_offset;
+
+    //  書き込みポインタ(次の出力データのアドレス)/フレーム内の出力データ数(pReferenceSizeで飽和)
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_write_pointer <= {lpOffsetWidth{1'b0}};
+            r_out_address   <= {lpOffsetWidth{1'b0}};
+            r_size          <= {lpSizeWidth{1'b0}};
+        end
+        else if (w_last_data_done) begin
+            r_write_pointer <= {lpOffsetWidth{1'b0}};
+            r_out_address   <= {lpOffsetWidth{1'b0}};
+            r_size          <= {lpSizeWidth{1'b0}};
+        end
+        else if (w_shift) begin
+            r_write_pointer <= r_write_pointer + {{(lpOffsetWidth-1){1'b0}}, 1'b1};
+            r_out_address   <= r_write_pointer;
+            if (!r_size[lpSizeWidth-1]) begin
+                r_size  <= r_size + {{(lpSizeWidth-1){1'b0}}, 1'b1};
+            end
+        end
+    end
+
+    lzss_ram #(
+        .pWidth (pDataWidth     ),
+        .pDepth (pReferenceSize )
+    ) u_data_ram (
+        .clk        (clk                        ),
+        .i_we       (w_out_ack                  ),
+        .i_waddr    (r_out_address              ),
+        .i_wdata    (w_data                     ),
+        .i_re       (w_shift                    ),
+        .i_raddr    (r_write_pointer + w_offset ),
+        .o_rdata    (w_ram_data                 )
+    );
+
+//----------------------------------------------------------------------
+//  データ出力
+//----------------------------------------------------------------------
+    assign  o_data  = w_data;
+    assign  o_last  = r_last;
+
+    //  距離1は同じサイクルに書き込まれるデータのため直前の出力データを使用する
+    assign  w_data  = (r_sel_ram     ) ? w_ram_data
+                    : (r_sel_previous) ? r_previous_data
+                                       : r_literal;
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_literal       <= {pDataWidth{1'b0}};
+            r_sel_ram       <= 1'b0;
+            r_sel_previous  <= 1'b0;
+        end
+        else if (w_last_data_done) begin
+            r_literal       <= {pDataWidth{1'b0}};
+            r_sel_ram       <= 1'b0;
+            r_sel_previous  <= 1'b0;
+        end
+        else if (w_shift) begin
+            r_literal       <= (w_unmatched) ? w_data_or_offset[pDataWidth-1:0] : {pDataWidth{1'b0}};
+            r_sel_ram       <= w_matched & (w_distance <= r_size) & (w_distance != 1);
+            r_sel_previous  <= w_matched & (w_distance <= r_size) & (w_distance == 1);
+        end
+    end
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_previous_data <= {pDataWidth{1'b0}};
+        end
+        else if (w_last_data_done) begin
+            r_previous_data <= {pDataWidth{1'b0}};
+        end
+        else if (w_out_ack) begin
+            r_previous_data <= w_data;
+        end
+    end
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_last  <= 1'b0;
+        end
+        else if (w_last_data_done) begin
+            r_last  <= 1'b0;
+        end
+        else if (w_shift && w_last) begin
+            if (w_unmatched || w_shift_count_eq_1) begin
+                r_last  <= 1'b1;
+            end
+        end
+    end
+
+endmodule
@@ -2,23 +2,35 @@
  *  @file   lzss_dec_top.v
  *  @brief  LZSSデコーダトップモジュール
  *
+ *  1サイクルで1コードの最大pBytesPerCycleバイトを出力する(o_keepは下位から連続)。
+ *  一致長がpBytesPerCycleを超える場合は複数サイクルに分けて出力する。
+ *  距離がpBytesPerCycleより短い(出力中のデータを参照する)場合は
+ *  距離を周期として参照部のデータを繰り返す。
+ *  pPerfCounter = 1の場合は入出力を観測する性能カウンタ(lzss_perf_counter)を持つ。
+ *
  *  @par    Copyright
  *  (C) 2012 Taichi Ishitani All Rights Reserved.
  *
  *  @author Taichi Ishitani
  *
  *  @date   0.0.00  2012/06/26  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     オフセット幅がデータ幅より大きい場合に対応
+ *  @date   0.0.02  2026/10/19  T. Ishitani     複数バイト出力(pBytesPerCycle)追加
+ *  @date   0.0.03  2026/10/19  T. Ishitani     性能カウンタ(pPerfCounter)追加
  */
 module lzss_dec_top #(
 //--type-------+name-------------------+value--------------------------+description
     parameter   pDataWidth              = 8,                            //<!    データ幅
     parameter   pReferenceSize          = 64,                           //<!    参照部サイズ
     parameter   pCodingSize             = 5,                            //<!    符号化部サイズ
+    parameter   pBytesPerCycle          = 1,                            //<!    1サイクルの最大出力バイト数
+    parameter   pPerfCounter            = 0,                            //<!    性能カウンタ(0:なし 1:あり)
     parameter   pCodeWidth              = get_code_width(               //<!    コード幅
                                             pDataWidth,
                                             pReferenceSize,
                                             pCodingSize
-                                          )
+                                          ),
+    parameter   pOutputWidth            = pDataWidth * pBytesPerCycle   //<!    出力幅
 )(
 //--type-------+width------------------+name---------------------------+description
     //  システム
@@ -32,8 +44,17 @@ module lzss_dec_top #(
     //  データ出力
     output                              o_valid,                        //<!    出力データバリッド
     input                               i_ready,                        //<!    出力データレディ
-    output      [pDataWidth-1:0]        o_data,                         //<!    出力データ
-    output                              o_last                          //<!    出力データラスト
+    output      [pOutputWidth-1:0]      o_data,                         //<!    出力データ(下位側が先)
+    output      [pBytesPerCycle-1:0]    o_keep,                         //<!    出力データ有効
+    output                              o_last,                         //<!    出力データラスト
+    //  性能カウンタ(pPerfCounter = 1のみ、lzss_perf_counter.v参照)
+    input                               i_psel,                         //<!    セレクト
+    input                               i_penable,                      //<!    イネーブル
+    input                               i_pwrite,                       //<!    ライト
+    input       [7:0]                   i_paddr,                        //<!    アドレス
+    input       [31:0]                  i_pwdata,                       //<!    ライトデータ
+    output      [31:0]                  o_prdata,                       //<!    リードデータ
+    output                              o_pready                        //<!    レディ
 );
 
     `include "lzss_function.vh"
@@ -41,8 +62,10 @@ module lzss_dec_top #(
 //--type-------+name-------------------+value--------------------------+description
     localparam  lpOffsetWidth           = log2(pReferenceSize);
     localparam  lpLengthWidth           = log2(pCodingSize) + 1;
+    localparam  lpValueWidth            = (pDataWidth > lpOffsetWidth) ? pDataWidth : lpOffsetWidth;
+    localparam  lpCountWidth            = log2(pBytesPerCycle) + 1;
     localparam  lpDataBufferSize        = pDataWidth * pReferenceSize;
-    localparam  lpSelSize               = pReferenceSize + 1;
+    localparam  lpHistogramBins         = (lpLengthWidth > 5) ? 16 : (1 << (lpLengthWidth - 1));
 
 //--type-------+width------------------+name---------------------------+description
     wire                                w_valid;
@@ -54,7 +77,7 @@ module lzss_dec_top #(
     wire                                w_flag;
     wire                                w_matched;
     wire                                w_unmatched;
-    wire        [pDataWidth-1:0]        w_data_or_offset;
+    wire        [lpValueWidth-1:0]      w_data_or_offset;
     wire        [lpLengthWidth-1:0]     w_length;
     wire                                w_shift;
     wire                                w_new_code;
@@ -62,13 +85,17 @@ module lzss_dec_top #(
     reg         [lpLengthWidth-1:0]     r_shift_count;
     wire                                w_shift_count_ne_0;
     wire                                w_shift_count_eq_0;
-    wire                                w_shift_count_eq_1;
+    wire        [lpLengthWidth-1:0]     w_remain;
+    wire                                w_final;
+    wire        [lpCountWidth-1:0]      w_count;
+    wire        [lpOffsetWidth-1:0]     w_offset;
+    wire        [lpOffsetWidth:0]       w_distance;
     wire        [lpDataBufferSize-1:0]  w_data_buffer;
-    reg         [pDataWidth-1:0]        r_data;
+    reg         [pOutputWidth-1:0]      r_data;
+    reg         [pBytesPerCycle-1:0]    r_keep;
     reg                                 r_last;
-    wire        [pDataWidth-1:0]        w_data;
-    wire        [pDataWidth-1:0]        w_sel_data[0:lpSelSize-1];
-    wire        [lpSelSize-1:0]         w_sel;
+    wire        [pOutputWidth-1:0]      w_data;
+    wire        [pBytesPerCycle-1:0]    w_keep;
     genvar                              i;
     genvar                              j;
 
@@ -103,7 +130,8 @@ module lzss_dec_top #(
 //----------------------------------------------------------------------
     assign  o_valid = r_valid;
 
-    assign  w_ready     = ((w_out_ack & (w_shift_count_eq_1 | w_unmatched)) | (w_unmatched & w_no_data)) & (~r_last);
+    //  コードの最後のデータを出力するサイクルで次のコードを受け付ける
+    assign  w_ready     = w_shift & w_final & (~r_last);
     assign  w_out_ack   = r_valid & i_ready;
     assign  w_no_data   = ~r_valid;
 
@@ -126,51 +154,61 @@ module lzss_dec_top #(
     assign  w_shift             = w_new_code | (w_out_ack & w_shift_count_ne_0);
     assign  w_last_data_done    = w_out_ack & r_last;
 
+    //  残りデータ数(コードの先頭では一致長、リテラルは1)/今回の出力数
+    assign  w_remain    = (~w_new_code) ? r_shift_count
+                        : (w_matched  ) ? w_length + {{(lpLengthWidth-1){1'b0}}, 1'b1}
+                                        : {{(lpLengthWidth-1){1'b0}}, 1'b1};
+    assign  w_final     = (w_remain <= pBytesPerCycle) ? 1'b1 : 1'b0;
+    assign  w_count     = (w_final) ? w_remain : pBytesPerCycle;
+
     assign  w_shift_count_ne_0  = |r_shift_count;
     assign  w_shift_count_eq_0  = ~w_shift_count_ne_0;
-    assign  w_shift_count_eq_1  = (~|r_shift_count[lpLengthWidth-1:1]) & r_shift_count[0];
     always @(posedge clk or negedge rst_x) begin
         if (!rst_x) begin
             r_shift_count   <= {lpLengthWidth{1'b0}};
         end
-        else if (w_new_code) begin
-            r_shift_count   <= w_length;
-        end
-        else if (w_out_ack && w_shift_count_ne_0) begin
-            r_shift_count   <= r_shift_count + {lpLengthWidth{1'b1}};
+        else if (w_shift) begin
+            r_shift_count   <= w_remain - w_count;
         end
     end
 
 //----------------------------------------------------------------------
-//  参照データバッファ
+//  参照データバッファ(出力したデータをシフトイン)
 //----------------------------------------------------------------------
     lzss_buffer #(
-        .pWidth (pDataWidth     ),
-        .pDepth (pReferenceSize )
+        .pWidth         (pDataWidth     ),
+        .pDepth         (pReferenceSize ),
+        .pShift         (pBytesPerCycle ),
+        .pVariableShift (1              )
     ) u_data_buffer (
-        .clk        (clk                ),
-        .rst_x      (rst_x              ),
-        .i_clear    (w_last_data_done   ),
-        .i_shift    (w_shift            ),
-        .i_d        (r_data             ),
-        .o_d        (w_data_buffer      )
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_data_done   ),
+        .i_shift        (w_shift            ),
+        .i_shift_count  (w_count            ),
+        .i_d            (w_data             ),
+        .o_d            (w_data_buffer      )
     );
 
 //----------------------------------------------------------------------
 //  データ出力
 //----------------------------------------------------------------------
     assign  o_data  = r_data;
+    assign  o_keep  = r_keep;
     assign  o_last  = r_last;
 
     always @(posedge clk or negedge rst_x) begin
         if (!rst_x) begin
-            r_data  <= {pDataWidth{1'b0}};
+            r_data  <= {pOutputWidth{1'b0}};
+            r_keep  <= {pBytesPerCycle{1'b0}};
         end
         else if (w_last_data_done) begin
-            r_data  <= {pDataWidth{1'b0}};
+            r_data  <= {pOutputWidth{1'b0}};
+            r_keep  <= {pBytesPerCycle{1'b0}};
         end
         else if (w_shift) begin
             r_data  <= w_data;
+            r_keep  <= w_keep;
         end
     end
 
@@ -181,32 +219,71 @@ module lzss_dec_top #(
         else if (w_last_data_done) begin
             r_last  <= 1'b0;
         end
-        else if (w_shift && w_last) begin
-            if (w_unmatched || w_shift_count_eq_1) begin
-                r_last  <= 1'b1;
-            end
+        else if (w_shift && w_last && w_final) begin
+            r_last  <= 1'b1;
         end
     end
 
+    //  距離 = pReferenceSize - オフセット
+    assign  w_offset    = w_data_or_offset[lpOffsetWidth-1:0];
+    assign  w_distance  = pReferenceSize - w_offset;
+
     generate
-        for (i = 0;i < lpSelSize;i = i + 1) begin : data_sel_loop
-            if (i < (lpSelSize - 1)) begin : matched
-                assign  w_sel[i]        = ((w_data_or_offset[lpOffsetWidth-1:0] == i[lpOffsetWidth-1:0]) && w_matched) ? 1'b1 : 1'b0;
-                assign  w_sel_data[i]   = w_data_buffer[i*pDataWidth+:pDataWidth];
+        for (i = 0;i < pBytesPerCycle;i = i + 1) begin : lane_loop
+            wire    [lpOffsetWidth-1:0] w_relative[0:i];
+            wire    [lpOffsetWidth-1:0] w_index;
+
+            //  距離がレーン番号以下の場合はレーン番号 % 距離の位置を参照する
+            assign  w_relative[0]   = i;
+            for (j = 1;j <= i;j = j + 1) begin : relative_loop
+                assign  w_relative[j]   = (w_distance == j) ? (i % j) : w_relative[j-1];
             end
-            else begin : unmatced
-                assign  w_sel[i]        = w_unmatched;
-                assign  w_sel_data[i]   = w_data_or_offset[pDataWidth-1:0];
+            assign  w_index = w_offset + w_relative[i];
+
+            if (i == 0) begin : first
+                assign  w_data[i*pDataWidth+:pDataWidth]    = (w_matched) ? w_data_buffer[w_index*pDataWidth+:pDataWidth]
+                                                                          : w_data_or_offset[pDataWidth-1:0];
             end
+            else begin : other
+                assign  w_data[i*pDataWidth+:pDataWidth]    = w_data_buffer[w_index*pDataWidth+:pDataWidth];
+            end
+            assign  w_keep[i]   = (i < w_count) ? 1'b1 : 1'b0;
         end
+    endgenerate
 
-        for (i = 0;i < pDataWidth;i = i + 1) begin : data_loop1
-            wire    [lpSelSize-1:0] w_data_temp;
-
-            assign  w_data[i]   = |(w_sel & w_data_temp);
-            for (j = 0;j < lpSelSize;j = j + 1) begin : data_loop2
-                assign  w_data_temp[j]  = w_sel_data[j][i];
-            end
+//----------------------------------------------------------------------
+//  性能カウンタ
+//----------------------------------------------------------------------
+    generate
+        if (pPerfCounter) begin : perf_counter
+            lzss_perf_counter #(
+                .pCodeWidth     (pCodeWidth         ),
+                .pLengthWidth   (lpLengthWidth - 1  ),
+                .pDataLanes     (pBytesPerCycle     ),
+                .pCodeLanes     (1                  ),
+                .pHistogramBins (lpHistogramBins    )
+            ) u_perf_counter (
+                .clk            (clk        ),
+                .rst_x          (rst_x      ),
+                .i_data_valid   (r_valid    ),
+                .i_data_ready   (i_ready    ),
+                .i_data_keep    (r_keep     ),
+                .i_code_valid   (i_valid    ),
+                .i_code_ready   (ow_ready   ),
+                .i_code         (i_code     ),
+                .i_code_keep    (1'b1       ),
+                .i_psel         (i_psel     ),
+                .i_penable      (i_penable  ),
+                .i_pwrite       (i_pwrite   ),
+                .i_paddr        (i_paddr    ),
+                .i_pwdata       (i_pwdata   ),
+                .o_prdata       (o_prdata   ),
+                .o_pready       (o_pready   )
+            );
+        end
+        else begin : no_perf_counter
+            assign  o_prdata    = 32'h0;
+            assign  o_pready    = 1'b1;
         end
     endgenerate
 
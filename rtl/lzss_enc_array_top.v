@@ -0,0 +1,312 @@
+/**
+ *  @file   lzss_enc_array_top.v
+ *  @brief  LZSSエンコーダアレイトップモジュール
+ *
+ *  pLanes個のlzss_enc_topを並列に動作させる。
+ *  入力はストリームID(i_id)付きで、異なるストリームのビートが混在してよい。
+ *  フレーム(i_lastまで)の先頭で空いているレーンを割り当て、フレームの最後まで同じレーンに入力する。
+ *  同じストリームの次のフレームは前のフレームの出力が完了するまで待たせるため、
+ *  ストリーム内のフレームの順序は保たれる。
+ *  空きレーンがない間、新しいフレームのビートは待たされる(入力途中のフレームは最大pLanes個とすること)。
+ *  出力は各レーンから1ビートずつラウンドロビンで取り出し、ストリームID(o_id)を付ける。
+ *  入出力のビート幅はレーンのpLanes倍とし、各レーンの入出力キュー(lzss_enc_queue)で幅を変換する。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_enc_array_top #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pDataWidth              = 8,                            //!<    データ幅
+    parameter   pReferenceSize          = 64,                           //!<    参照部サイズ
+    parameter   pCodingSize             = 5,                            //!<    符号化部サイズ
+    parameter   pBytesPerCycle          = 1,                            //!<    レーンの1サイクルの入力バイト数
+    parameter   pLanes                  = 4,                            //!<    レーン数
+    parameter   pIdWidth                = 4,                            //!<    ストリームID幅
+    parameter   pInputBytes             = pLanes * pBytesPerCycle,      //!<    入力ビートのバイト数
+    parameter   pOutputCodes            = pLanes * pBytesPerCycle,      //!<    出力ビートのコード数
+    parameter   pQueueDepth             = 2 * pInputBytes,              //!<    入力キューの深さ
+    parameter   pCodeWidth              = get_code_width(               //!<    コード幅
+                                            pDataWidth,
+                                            pReferenceSize,
+                                            pCodingSize
+                                          ),
+    parameter   pInputWidth             = pDataWidth * pInputBytes,     //!<    入力幅
+    parameter   pOutputWidth            = pCodeWidth * pOutputCodes     //!<    出力幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  データ入力
+    input                               i_valid,                        //!<    入力データバリッド
+    output                              ow_ready,                       //!<    入力データレディ
+    input       [pIdWidth-1:0]          i_id,                           //!<    入力ストリームID
+    input       [pInputWidth-1:0]       i_data,                         //!<    入力データ(下位側が先)
+    input       [pInputBytes-1:0]       i_keep,                         //!<    入力データ有効(下位から連続)
+    input                               i_last,                         //!<    入力データラスト
+    //  コード出力
+    output                              o_valid,                        //!<    出力コードバリッド
+    input                               i_ready,                        //!<    出力コードレディ
+    output      [pIdWidth-1:0]          o_id,                           //!<    出力ストリームID
+    output      [pOutputWidth-1:0]      o_code,                         //!<    出力コード(下位側が先)
+    output      [pOutputCodes-1:0]      o_keep,                         //!<    出力コード有効(下位から連続)
+    output                              o_last                          //!<    出力コードラスト
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpLaneIndexWidth        = log2(pLanes) + 1;
+    localparam  lpLaneInputWidth        = pDataWidth * pBytesPerCycle;
+    localparam  lpLaneOutputWidth       = pCodeWidth * pBytesPerCycle;
+    localparam  lpInEntryWidth          = pDataWidth + 1;
+    localparam  lpOutEntryWidth         = pCodeWidth + 1;
+    localparam  lpLaneCountWidth        = log2(pBytesPerCycle) + 1;
+    localparam  lpOutCountWidth         = log2(pOutputCodes) + 1;
+
+//--type-------+width------------------+name---------------------------+description
+    //  入力アービタ
+    reg         [pLanes-1:0]            r_busy;
+    reg         [pLanes-1:0]            r_receiving;
+    reg         [pIdWidth-1:0]          r_id[0:pLanes-1];
+    wire        [pLanes-1:0]            w_hit;
+    wire        [pLanes-1:0]            w_same;
+    wire        [pLanes:0]              w_free_found;
+    wire        [pLanes-1:0]            w_free_sel;
+    wire        [pLanes-1:0]            w_target;
+    wire        [pLanes-1:0]            w_push_ready;
+    wire        [pInputBytes-1:0]       w_entry_last;
+    wire        [pInputBytes*lpInEntryWidth-1:0]
+                                        w_push_d;
+    wire                                w_in_ack;
+    //  出力マージャ
+    wire        [pLanes-1:0]            w_request;
+    wire        [2*pLanes-1:0]          w_rotated;
+    wire        [pLanes:0]              w_rotated_found;
+    wire        [lpLaneIndexWidth-1:0]  w_rotated_index[0:pLanes];
+    wire        [lpLaneIndexWidth:0]    w_grant_sum;
+    wire        [lpLaneIndexWidth-1:0]  w_grant;
+    wire        [lpLaneIndexWidth-1:0]  w_next_pointer;
+    reg         [lpLaneIndexWidth-1:0]  r_pointer;
+    wire                                w_out_ack;
+    wire        [pLanes*pOutputWidth-1:0]
+                                        w_out_code;
+    wire        [pLanes*pOutputCodes-1:0]
+                                        w_out_keep;
+    wire        [pLanes-1:0]            w_out_last;
+    genvar                              i;
+    genvar                              k;
+
+//----------------------------------------------------------------------
+//  入力アービタ
+//----------------------------------------------------------------------
+    //  受信中のレーン > (同じストリームが処理中でなければ)番号の小さい空きレーン
+    assign  w_free_found[0] = 1'b0;
+    generate
+        for (k = 0;k < pLanes;k = k + 1) begin : arbiter_loop
+            assign  w_hit[k]            = r_receiving[k] & (r_id[k] == i_id);
+            assign  w_same[k]           = r_busy[k]      & (r_id[k] == i_id);
+            assign  w_free_sel[k]       = (~r_busy[k]) & (~w_free_found[k]);
+            assign  w_free_found[k+1]   = w_free_found[k] | (~r_busy[k]);
+            assign  w_target[k]         = (|w_hit ) ? w_hit[k]
+                                        : (|w_same) ? 1'b0
+                                                    : w_free_sel[k];
+
+            always @(posedge clk or negedge rst_x) begin
+                if (!rst_x) begin
+                    r_busy[k]       <= 1'b0;
+                    r_receiving[k]  <= 1'b0;
+                    r_id[k]         <= {pIdWidth{1'b0}};
+                end
+                else if (w_out_ack && w_out_last[k] && (w_grant == k)) begin
+                    r_busy[k]       <= 1'b0;
+                end
+                else if (w_in_ack && w_target[k]) begin
+                    r_busy[k]       <= 1'b1;
+                    r_receiving[k]  <= ~i_last;
+                    r_id[k]         <= i_id;
+                end
+            end
+        end
+
+        //  ラストはビートの最後の有効データに付ける
+        for (i = 0;i < pInputBytes;i = i + 1) begin : entry_loop
+            if (i == (pInputBytes - 1)) begin : last
+                assign  w_entry_last[i] = i_last & i_keep[i];
+            end
+            else begin : other
+                assign  w_entry_last[i] = i_last & i_keep[i] & (~i_keep[i+1]);
+            end
+            assign  w_push_d[i*lpInEntryWidth+:lpInEntryWidth] = {w_entry_last[i], i_data[i*pDataWidth+:pDataWidth]};
+        end
+    endgenerate
+
+    assign  ow_ready    = |(w_target & w_push_ready);
+    assign  w_in_ack    = i_valid & ow_ready;
+
+//----------------------------------------------------------------------
+//  レーン
+//----------------------------------------------------------------------
+    generate
+        for (k = 0;k < pLanes;k = k + 1) begin : lane_loop
+            wire    [pBytesPerCycle-1:0]                    w_in_valid;
+            wire    [pBytesPerCycle*lpInEntryWidth-1:0]     w_in_entry;
+            wire    [pBytesPerCycle-1:0]                    w_in_last;
+            wire    [pBytesPerCycle:0]                      w_in_last_found;
+            wire    [pBytesPerCycle-1:0]                    w_in_keep;
+            wire    [lpLaneCountWidth-1:0]                  w_in_count[0:pBytesPerCycle];
+            wire    [lpLaneInputWidth-1:0]                  w_lane_data;
+            wire                                            w_lane_valid;
+            wire                                            w_lane_ready;
+            wire                                            w_lane_last;
+            wire                                            w_lane_out_valid;
+            wire                                            w_lane_out_ready;
+            wire    [lpLaneOutputWidth-1:0]                 w_lane_code;
+            wire    [pBytesPerCycle-1:0]                    w_lane_keep;
+            wire                                            w_lane_out_last;
+            wire    [pBytesPerCycle*lpOutEntryWidth-1:0]    w_code_entry;
+            wire    [pOutputCodes-1:0]                      w_out_valid;
+            wire    [pOutputCodes*lpOutEntryWidth-1:0]      w_out_entry;
+            wire    [pOutputCodes-1:0]                      w_out_entry_last;
+            wire    [pOutputCodes:0]                        w_out_last_found;
+            wire    [lpOutCountWidth-1:0]                   w_out_count[0:pOutputCodes];
+
+            //  入力キュー(入力ビート幅 -> レーン幅)
+            lzss_enc_queue #(
+                .pWidth     (lpInEntryWidth ),
+                .pPushNum   (pInputBytes    ),
+                .pPopNum    (pBytesPerCycle ),
+                .pDepth     (pQueueDepth    )
+            ) u_in_queue (
+                .clk            (clk                                                        ),
+                .rst_x          (rst_x                                                      ),
+                .i_clear        (1'b0                                                       ),
+                .i_push         (w_in_ack & w_target[k]                                     ),
+                .o_push_ready   (w_push_ready[k]                                            ),
+                .i_push_keep    (i_keep                                                     ),
+                .i_push_d       (w_push_d                                                   ),
+                .i_pop_count    ((w_lane_valid & w_lane_ready) ? w_in_count[pBytesPerCycle] : {lpLaneCountWidth{1'b0}}),
+                .o_valid        (w_in_valid                                                 ),
+                .o_d            (w_in_entry                                                 )
+            );
+
+            //  次のフレームのデータはレーンに入力しない
+            assign  w_in_last_found[0]  = 1'b0;
+            assign  w_in_count[0]       = {lpLaneCountWidth{1'b0}};
+            for (i = 0;i < pBytesPerCycle;i = i + 1) begin : in_entry_loop
+                assign  w_in_last[i]                                = w_in_entry[i*lpInEntryWidth+pDataWidth];
+                assign  w_lane_data[i*pDataWidth+:pDataWidth]       = w_in_entry[i*lpInEntryWidth+:pDataWidth];
+                assign  w_in_keep[i]                                = w_in_valid[i] & (~w_in_last_found[i]);
+                assign  w_in_last_found[i+1]                        = w_in_last_found[i] | (w_in_valid[i] & w_in_last[i]);
+                assign  w_in_count[i+1]                             = w_in_count[i] + w_in_keep[i];
+            end
+            assign  w_lane_last     = |(w_in_keep & w_in_last);
+            assign  w_lane_valid    = w_in_valid[pBytesPerCycle-1] | w_lane_last;
+
+            lzss_enc_top #(
+                .pDataWidth     (pDataWidth     ),
+                .pReferenceSize (pReferenceSize ),
+                .pCodingSize    (pCodingSize    ),
+                .pBytesPerCycle (pBytesPerCycle )
+            ) u_lane (
+                .clk        (clk                ),
+                .rst_x      (rst_x              ),
+                .i_valid    (w_lane_valid       ),
+                .ow_ready   (w_lane_ready       ),
+                .i_data     (w_lane_data        ),
+                .i_keep     (w_in_keep          ),
+                .i_last     (w_lane_last        ),
+                .o_valid    (w_lane_out_valid   ),
+                .i_ready    (w_lane_out_ready   ),
+                .o_code     (w_lane_code        ),
+                .o_keep     (w_lane_keep        ),
+                .o_last     (w_lane_out_last    ),
+                .i_psel     (1'b0               ),
+                .i_penable  (1'b0               ),
+                .i_pwrite   (1'b0               ),
+                .i_paddr    (8'h00              ),
+                .i_pwdata   (32'h0              ),
+                .o_prdata   (                   ),
+                .o_pready   (                   )
+            );
+
+            //  出力キュー(レーン幅 -> 出力ビート幅)
+            for (i = 0;i < pBytesPerCycle;i = i + 1) begin : code_entry_loop
+                if (i == (pBytesPerCycle - 1)) begin : last
+                    assign  w_code_entry[i*lpOutEntryWidth+:lpOutEntryWidth]    = {w_lane_out_last & w_lane_keep[i], w_lane_code[i*pCodeWidth+:pCodeWidth]};
+                end
+                else begin : other
+                    assign  w_code_entry[i*lpOutEntryWidth+:lpOutEntryWidth]    = {w_lane_out_last & w_lane_keep[i] & (~w_lane_keep[i+1]), w_lane_code[i*pCodeWidth+:pCodeWidth]};
+                end
+            end
+
+            lzss_enc_queue #(
+                .pWidth     (lpOutEntryWidth    ),
+                .pPushNum   (pBytesPerCycle     ),
+                .pPopNum    (pOutputCodes       ),
+                .pDepth     (2 * pOutputCodes   )
+            ) u_out_queue (
+                .clk            (clk                                                        ),
+                .rst_x          (rst_x                                                      ),
+                .i_clear        (1'b0                                                       ),
+                .i_push         (w_lane_out_valid & w_lane_out_ready                        ),
+                .o_push_ready   (w_lane_out_ready                                           ),
+                .i_push_keep    (w_lane_keep                                                ),
+                .i_push_d       (w_code_entry                                               ),
+                .i_pop_count    ((w_out_ack && (w_grant == k)) ? w_out_count[pOutputCodes] : {lpOutCountWidth{1'b0}}),
+                .o_valid        (w_out_valid                                                ),
+                .o_d            (w_out_entry                                                )
+            );
+
+            //  1ビートはフレームの最後のコードまで
+            assign  w_out_last_found[0] = 1'b0;
+            assign  w_out_count[0]      = {lpOutCountWidth{1'b0}};
+            for (i = 0;i < pOutputCodes;i = i + 1) begin : out_entry_loop
+                assign  w_out_entry_last[i]                         = w_out_entry[i*lpOutEntryWidth+pCodeWidth];
+                assign  w_out_code[k*pOutputWidth+i*pCodeWidth+:pCodeWidth]  = w_out_entry[i*lpOutEntryWidth+:pCodeWidth];
+                assign  w_out_keep[k*pOutputCodes+i]                  = w_out_valid[i] & (~w_out_last_found[i]);
+                assign  w_out_last_found[i+1]                       = w_out_last_found[i] | (w_out_valid[i] & w_out_entry_last[i]);
+                assign  w_out_count[i+1]                            = w_out_count[i] + w_out_keep[k*pOutputCodes+i];
+            end
+            assign  w_out_last[k]   = |(w_out_keep[k*pOutputCodes+:pOutputCodes] & w_out_entry_last);
+            assign  w_request[k]    = w_out_valid[pOutputCodes-1] | w_out_last[k];
+        end
+    endgenerate
+
+//----------------------------------------------------------------------
+//  出力マージャ(r_pointerのレーンから順に要求のあるレーンを選択)
+//----------------------------------------------------------------------
+    assign  w_rotated           = {w_request, w_request} >> r_pointer;
+    assign  w_rotated_found[0]  = 1'b0;
+    assign  w_rotated_index[0]  = {lpLaneIndexWidth{1'b0}};
+    generate
+        for (k = 0;k < pLanes;k = k + 1) begin : merger_loop
+            assign  w_rotated_found[k+1]    = w_rotated_found[k] | w_rotated[k];
+            assign  w_rotated_index[k+1]    = (w_rotated[k] && (!w_rotated_found[k])) ? k : w_rotated_index[k];
+        end
+    endgenerate
+    assign  w_grant_sum     = r_pointer + w_rotated_index[pLanes];
+    assign  w_grant         = (w_grant_sum >= pLanes) ? w_grant_sum - pLanes : w_grant_sum;
+    assign  w_next_pointer  = (w_grant == (pLanes - 1)) ? {lpLaneIndexWidth{1'b0}} : w_grant + 1;
+
+    assign  o_valid     = |w_request;
+    assign  o_id        = r_id[w_grant];
+    assign  o_code      = w_out_code[w_grant*pOutputWidth+:pOutputWidth];
+    assign  o_keep      = w_out_keep[w_grant*pOutputCodes+:pOutputCodes];
+    assign  o_last      = w_out_last[w_grant];
+    assign  w_out_ack   = o_valid & i_ready;
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_pointer   <= {lpLaneIndexWidth{1'b0}};
+        end
+        else if (w_out_ack) begin
+            r_pointer   <= w_next_pointer;
+        end
+    end
+
+endmodule
@@ -0,0 +1,156 @@
+/**
+ *  @file   lzss_enc_axis_top.v
+ *  @brief  AXI4-Stream LZSSエンコーダトップモジュール
+ *
+ *  pAxisBytesバイトのAXI4-Streamでデータを入力し(lzss_axis_in)、lzss_enc_topでエンコードしたコードを
+ *  ビット列に詰めてpAxisBytesバイトのAXI4-Streamで出力する(lzss_axis_out)。
+ *  1フレーム(TLASTまで)を1つのLZSSフレームとしてエンコードする。
+ *  pBytesPerCycle = pAxisBytesの場合、入力バスの全ビートをストールなしで受け付けられる。
+ *  デコーダ(lzss_dec_top)のAXI4-Stream版はない(コードのビット列の切り出しが必要なため)。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_enc_axis_top #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pDataWidth              = 8,                            //!<    データ幅
+    parameter   pReferenceSize          = 64,                           //!<    参照部サイズ
+    parameter   pCodingSize             = 5,                            //!<    符号化部サイズ
+    parameter   pBytesPerCycle          = 8,                            //!<    エンコーダの1サイクルの入力バイト数
+    parameter   pAxisBytes              = 8,                            //!<    AXI4-Streamのバイト数(2のべき乗)
+    parameter   pEarlyLiterals          = 0,                            //!<    フレーム先頭の早期リテラル数
+    parameter   pSearchRegisterInterval = 1,                            //!<    検索のレジスタを入れる段の間隔(0:なし)
+    parameter   pPerfCounter            = 0,                            //!<    性能カウンタ(0:なし 1:あり)
+    parameter   pCodeWidth              = get_code_width(               //!<    コード幅
+                                            pDataWidth,
+                                            pReferenceSize,
+                                            pCodingSize
+                                          ),
+    parameter   pAxisWidth              = 8 * pAxisBytes                //!<    TDATA幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  データ入力(AXI4-Stream)
+    input                               i_s_tvalid,                     //!<    TVALID
+    output                              ow_s_tready,                    //!<    TREADY
+    input       [pAxisWidth-1:0]        i_s_tdata,                      //!<    TDATA(下位バイトが先)
+    input       [pAxisBytes-1:0]        i_s_tkeep,                      //!<    TKEEP
+    input                               i_s_tlast,                      //!<    TLAST
+    //  コード出力(AXI4-Stream)
+    output                              o_m_tvalid,                     //!<    TVALID
+    input                               i_m_tready,                     //!<    TREADY
+    output      [pAxisWidth-1:0]        o_m_tdata,                      //!<    TDATA(下位ビットが先)
+    output      [pAxisBytes-1:0]        o_m_tkeep,                      //!<    TKEEP
+    output                              o_m_tlast,                      //!<    TLAST
+    //  性能カウンタ(pPerfCounter = 1のみ、lzss_perf_counter.v参照)
+    input                               i_psel,                         //!<    セレクト
+    input                               i_penable,                      //!<    イネーブル
+    input                               i_pwrite,                       //!<    ライト
+    input       [7:0]                   i_paddr,                        //!<    アドレス
+    input       [31:0]                  i_pwdata,                       //!<    ライトデータ
+    output      [31:0]                  o_prdata,                       //!<    リードデータ
+    output                              o_pready                        //!<    レディ
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpInputWidth            = pDataWidth * pBytesPerCycle;
+    localparam  lpOutputWidth           = pCodeWidth * pBytesPerCycle;
+
+//--type-------+width------------------+name---------------------------+description
+    wire                                w_in_valid;
+    wire                                w_in_ready;
+    wire        [lpInputWidth-1:0]      w_in_data;
+    wire        [pBytesPerCycle-1:0]    w_in_keep;
+    wire                                w_in_last;
+    wire                                w_out_valid;
+    wire                                w_out_ready;
+    wire        [lpOutputWidth-1:0]     w_out_code;
+    wire        [pBytesPerCycle-1:0]    w_out_keep;
+    wire                                w_out_last;
+
+//----------------------------------------------------------------------
+//  入力アダプタ
+//----------------------------------------------------------------------
+    lzss_axis_in #(
+        .pDataWidth     (pDataWidth     ),
+        .pAxisBytes     (pAxisBytes     ),
+        .pBytesPerCycle (pBytesPerCycle )
+    ) u_axis_in (
+        .clk        (clk            ),
+        .rst_x      (rst_x          ),
+        .i_tvalid   (i_s_tvalid     ),
+        .ow_tready  (ow_s_tready    ),
+        .i_tdata    (i_s_tdata      ),
+        .i_tkeep    (i_s_tkeep      ),
+        .i_tlast    (i_s_tlast      ),
+        .o_valid    (w_in_valid     ),
+        .i_ready    (w_in_ready     ),
+        .o_data     (w_in_data      ),
+        .o_keep     (w_in_keep      ),
+        .o_last     (w_in_last      )
+    );
+
+//----------------------------------------------------------------------
+//  エンコーダ
+//----------------------------------------------------------------------
+    lzss_enc_top #(
+        .pDataWidth                 (pDataWidth                 ),
+        .pReferenceSize             (pReferenceSize             ),
+        .pCodingSize                (pCodingSize                ),
+        .pBytesPerCycle             (pBytesPerCycle             ),
+        .pEarlyLiterals             (pEarlyLiterals             ),
+        .pSearchRegisterInterval    (pSearchRegisterInterval    ),
+        .pPerfCounter               (pPerfCounter               )
+    ) u_enc (
+        .clk        (clk            ),
+        .rst_x      (rst_x          ),
+        .i_valid    (w_in_valid     ),
+        .ow_ready   (w_in_ready     ),
+        .i_data     (w_in_data      ),
+        .i_keep     (w_in_keep      ),
+        .i_last     (w_in_last      ),
+        .o_valid    (w_out_valid    ),
+        .i_ready    (w_out_ready    ),
+        .o_code     (w_out_code     ),
+        .o_keep     (w_out_keep     ),
+        .o_last     (w_out_last     ),
+        .i_psel     (i_psel         ),
+        .i_penable  (i_penable      ),
+        .i_pwrite   (i_pwrite       ),
+        .i_paddr    (i_paddr        ),
+        .i_pwdata   (i_pwdata       ),
+        .o_prdata   (o_prdata       ),
+        .o_pready   (o_pready       )
+    );
+
+//----------------------------------------------------------------------
+//  出力アダプタ
+//----------------------------------------------------------------------
+    lzss_axis_out #(
+        .pCodeWidth     (pCodeWidth     ),
+        .pCodesPerCycle (pBytesPerCycle ),
+        .pAxisBytes     (pAxisBytes     )
+    ) u_axis_out (
+        .clk        (clk            ),
+        .rst_x      (rst_x          ),
+        .i_valid    (w_out_valid    ),
+        .ow_ready   (w_out_ready    ),
+        .i_code     (w_out_code     ),
+        .i_keep     (w_out_keep     ),
+        .i_last     (w_out_last     ),
+        .o_tvalid   (o_m_tvalid     ),
+        .i_tready   (i_m_tready     ),
+        .o_tdata    (o_m_tdata      ),
+        .o_tkeep    (o_m_tkeep      ),
+        .o_tlast    (o_m_tlast      )
+    );
+
+endmodule
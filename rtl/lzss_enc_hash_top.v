@@ -0,0 +1,538 @@
+/**
+ *  @file   lzss_enc_hash_top.v
+ *  @brief  LZSSエンコーダトップモジュール(RAM履歴 + ハッシュ索引)
+ *
+ *  参照部をRAM(lzss_ram)に、符号化位置の先頭2データのハッシュごとに
+ *  直近pCandidates個の位置をハッシュヘッドテーブル(lzss_ram)に持ち、
+ *  1位置/サイクルで候補位置のみと一致比較する。
+ *  各候補の参照データはpCodingSize以上の2のべき乗(lpLaneNum)バイトを1行とした
+ *  偶数行/奇数行の2バンクから連続2行を読み出して取り出す。
+ *  ハッシュヘッドテーブルの有効フラグはフレームごとにクリアする。
+ *  同じ一致長の候補は新しい位置を選択する(c_model/include/lzss_hash.hと同一の方針)。
+ *
+ *  パイプライン(バッファのインデックス)
+ *      lpHashIndex     : ハッシュ計算/ハッシュヘッドテーブル読み出し
+ *      lpReadIndex     : 候補位置の判定/ハッシュヘッドテーブル更新/参照データ読み出し
+ *      lpMatchIndex    : 一致比較/最長一致候補の選択
+ *      lpOutputIndex   : コード出力
+ *
+ *  pReferenceSizeは2のべき乗かつ2*lpLaneNum以上、pHashWidthはpDataWidth+4以下とする。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_enc_hash_top #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pDataWidth              = 8,                            //!<    データ幅
+    parameter   pReferenceSize          = 1024,                         //!<    参照部サイズ
+    parameter   pCodingSize             = 17,                           //!<    符号化部サイズ
+    parameter   pHashWidth              = 10,                           //!<    ハッシュ幅
+    parameter   pCandidates             = 2,                            //!<    1位置あたりの候補数
+    parameter   pCodeWidth              = get_code_width(               //!<    コード幅
+                                            pDataWidth,
+                                            pReferenceSize,
+                                            pCodingSize
+                                          )
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  データ入力
+    input                               i_valid,                        //!<    入力データバリッド
+    output                              ow_ready,                       //!<    入力データレディ
+    input       [pDataWidth-1:0]        i_data,                         //!<    入力データ
+    input                               i_last,                         //!<    入力データラスト
+    //  コード出力
+    output                              o_valid,                        //!<    出力コードバリッド
+    input                               i_ready,                        //!<    出力コードレディ
+    output      [pCodeWidth-1:0]        o_code,                         //!<    出力コード
+    output                              o_last                          //!<    出力コードラスト
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpOffsetWidth           = log2(pReferenceSize);
+    localparam  lpPositionWidth         = lpOffsetWidth + 1;
+    localparam  lpLengthWidth           = log2(pCodingSize) + 1;
+    localparam  lpCodeLengthWidth       = log2(pCodingSize - 1);
+    localparam  lpHashSize              = 1 << pHashWidth;
+    localparam  lpHeadWidth             = lpPositionWidth + 1;
+    localparam  lpTotalHead             = lpHeadWidth * pCandidates;
+    //  参照データの1行(lpLaneNumバイト)
+    localparam  lpLaneBits              = log2(pCodingSize - 1) + 1;
+    localparam  lpLaneNum               = 1 << lpLaneBits;
+    localparam  lpRowWidth              = pDataWidth * lpLaneNum;
+    localparam  lpRowBits               = lpPositionWidth - lpLaneBits;
+    localparam  lpBankDepth             = 1 << (lpRowBits - 1);
+    //  バッファ
+    localparam  lpOutputIndex           = 0;
+    localparam  lpMatchIndex            = 1;
+    localparam  lpReadIndex             = 2;
+    localparam  lpHashIndex             = 3;
+    localparam  lpBufferSize            = lpHashIndex + pCodingSize;
+    localparam  lpMatchingData          = pCodingSize  * pDataWidth;
+    localparam  lpTotalData             = lpBufferSize * pDataWidth;
+
+//--type-------+width------------------+name---------------------------+description
+    wire                                w_ready;
+    reg                                 r_valid;
+    wire                                w_in_ack;
+    wire                                w_out_ack;
+    wire                                w_new_code;
+    wire                                w_shift_enable;
+    wire                                w_shift;
+    reg         [lpLengthWidth-1:0]     r_shift_count;
+    reg                                 r_last_data_done;
+    wire                                w_last_code_done;
+    wire                                w_in_valid;
+    wire        [lpBufferSize-1:0]      w_valid_buffer;
+    wire        [lpTotalData-1:0]       w_data_buffer;
+    wire        [lpBufferSize-1:0]      w_last_buffer;
+    //  参照データ書き込み
+    reg         [lpPositionWidth-1:0]   r_write_position;
+    wire                                w_write;
+    wire        [lpRowBits-1:0]         w_write_row;
+    wire        [lpLaneNum-1:0]         w_write_lane;
+    wire        [lpLaneNum-1:0]         w_write_even;
+    wire        [lpLaneNum-1:0]         w_write_odd;
+    //  ハッシュ計算/ハッシュヘッドテーブル読み出し
+    reg         [lpPositionWidth-1:0]   r_position;
+    wire        [pDataWidth+3:0]        w_hash_temp;
+    wire        [pHashWidth-1:0]        w_hash;
+    reg         [lpHashSize-1:0]        r_bucket_valid;
+    //  候補位置の判定/ハッシュヘッドテーブル更新/参照データ読み出し
+    reg                                 r_read_valid;
+    reg         [lpPositionWidth-1:0]   r_read_position;
+    reg         [pHashWidth-1:0]        r_read_hash;
+    reg                                 r_read_bucket_valid;
+    reg                                 r_forward;
+    reg         [lpTotalHead-1:0]       r_forward_head;
+    wire        [lpTotalHead-1:0]       w_head_rdata;
+    wire        [lpTotalHead-1:0]       w_head;
+    wire                                w_bucket_valid;
+    wire        [lpTotalHead-1:0]       w_head_wdata;
+    wire        [pCandidates-1:0]       w_candidate;
+    wire        [lpPositionWidth-1:0]   w_distance[0:pCandidates-1];
+    //  一致比較/最長一致候補の選択
+    reg                                 r_match_candidate[0:pCandidates-1];
+    reg         [lpPositionWidth-1:0]   r_match_distance[0:pCandidates-1];
+    reg                                 r_match_row_odd[0:pCandidates-1];
+    reg         [lpLaneBits-1:0]        r_match_lane[0:pCandidates-1];
+    wire        [lpMatchingData-1:0]    w_coding_data;
+    wire        [pCodingSize-1:0]       w_coding_valid;
+    wire        [pCodingSize-1:0]       w_coding_last;
+    wire        [lpLengthWidth-1:0]     w_length[0:pCandidates-1];
+    wire        [pCodingSize-1:0]       w_match[0:pCandidates-1];
+    wire        [lpLengthWidth-1:0]     w_best_length[0:pCandidates];
+    wire        [lpPositionWidth-1:0]   w_best_distance[0:pCandidates];
+    wire        [pCodingSize-1:0]       w_best_match[0:pCandidates];
+    wire                                w_last;
+    //  コード出力
+    reg         [lpLengthWidth-1:0]     r_out_length;
+    reg         [lpPositionWidth-1:0]   r_out_distance;
+    reg                                 r_out_last;
+    wire                                w_start;
+    wire                                w_out_match;
+    wire        [lpPositionWidth-1:0]   w_out_offset;
+    wire        [lpLengthWidth-1:0]     w_out_length;
+    wire        [pDataWidth-1:0]        w_out_data;
+    wire        [pCodeWidth-1:0]        w_code;
+    reg         [pCodeWidth-1:0]        r_code;
+    reg                                 r_last;
+    genvar                              i;
+    genvar                              j;
+    genvar                              k;
+
+//----------------------------------------------------------------------
+//  入出力ハンドシェイク
+//----------------------------------------------------------------------
+    assign  ow_ready    = w_ready;
+    assign  o_valid     = r_valid;
+
+    assign  w_ready     = w_shift_enable & (~r_last_data_done);
+    assign  w_in_ack    = i_valid & w_ready;
+    assign  w_out_ack   = r_valid & i_ready;
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_valid <= 1'b0;
+        end
+        else if (w_new_code) begin
+            r_valid <= 1'b1;
+        end
+        else if (w_out_ack) begin
+            r_valid <= 1'b0;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  バッファ更新タイミング/出力タイミング制御
+//----------------------------------------------------------------------
+    //  コードを生成しないシフトは出力の空きを待たない
+    assign  w_shift_enable      = (~w_start) | w_out_ack | (~r_valid);
+    assign  w_shift             = w_shift_enable & (w_in_ack | r_last_data_done);
+    assign  w_new_code          = w_shift & w_start;
+    assign  w_last_code_done    = w_out_ack & r_last;
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_shift_count   <= {lpLengthWidth{1'b0}};
+        end
+        else if (w_last_code_done) begin
+            r_shift_count   <= {lpLengthWidth{1'b0}};
+        end
+        else if (w_shift && w_start && w_out_match) begin
+            r_shift_count   <= r_out_length + {lpLengthWidth{1'b1}};
+        end
+        else if (w_shift && (|r_shift_count)) begin
+            r_shift_count   <= r_shift_count + {lpLengthWidth{1'b1}};
+        end
+    end
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_last_data_done    <= 1'b0;
+        end
+        else if (w_last_code_done) begin
+            r_last_data_done    <= 1'b0;
+        end
+        else if (w_in_ack && i_last) begin
+            r_last_data_done    <= 1'b1;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  バッファ(符号化部 + パイプライン段数分)
+//----------------------------------------------------------------------
+    assign  w_in_valid  = i_valid & (~r_last_data_done);
+
+    //  バリッド
+    lzss_buffer #(
+        .pWidth (1              ),
+        .pDepth (lpBufferSize   )
+    ) u_valid_buffer (
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_code_done   ),
+        .i_shift        (w_shift            ),
+        .i_shift_count  (1'b0               ),
+        .i_d            (w_in_valid         ),
+        .o_d            (w_valid_buffer     )
+    );
+    //  データ
+    lzss_buffer #(
+        .pWidth (pDataWidth     ),
+        .pDepth (lpBufferSize   )
+    ) u_data_buffer (
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_code_done   ),
+        .i_shift        (w_shift            ),
+        .i_shift_count  (1'b0               ),
+        .i_d            (i_data             ),
+        .o_d            (w_data_buffer      )
+    );
+    //  ラスト
+    lzss_buffer #(
+        .pWidth (1              ),
+        .pDepth (lpBufferSize   )
+    ) u_last_buffer (
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_code_done   ),
+        .i_shift        (w_shift            ),
+        .i_shift_count  (1'b0               ),
+        .i_d            (w_in_valid & i_last),
+        .o_d            (w_last_buffer      )
+    );
+
+//----------------------------------------------------------------------
+//  参照データ書き込み(入力データをフレーム内の位置に書き込む)
+//----------------------------------------------------------------------
+    assign  w_write     = w_shift & w_in_valid;
+    assign  w_write_row = r_write_position[lpPositionWidth-1:lpLaneBits];
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_write_position    <= {lpPositionWidth{1'b0}};
+        end
+        else if (w_last_code_done) begin
+            r_write_position    <= {lpPositionWidth{1'b0}};
+        end
+        else if (w_write) begin
+            r_write_position    <= r_write_position + {{(lpPositionWidth-1){1'b0}}, 1'b1};
+        end
+    end
+
+    generate
+        for (j = 0;j < lpLaneNum;j = j + 1) begin : write_lane_loop
+            assign  w_write_lane[j] = (r_write_position[lpLaneBits-1:0] == j) ? w_write : 1'b0;
+        end
+    endgenerate
+    assign  w_write_even    = (w_write_row[0]) ? {lpLaneNum{1'b0}} : w_write_lane;
+    assign  w_write_odd     = (w_write_row[0]) ? w_write_lane      : {lpLaneNum{1'b0}};
+
+//----------------------------------------------------------------------
+//  ハッシュ計算/ハッシュヘッドテーブル読み出し(lpHashIndex)
+//----------------------------------------------------------------------
+    //  次のデータがない(ラスト)場合は0とする
+    assign  w_hash_temp = {w_data_buffer[lpHashIndex*pDataWidth+:pDataWidth], 4'b0000}
+                        ^ {4'b0000, w_data_buffer[(lpHashIndex+1)*pDataWidth+:pDataWidth] & {pDataWidth{w_valid_buffer[lpHashIndex+1]}}};
+    assign  w_hash      = w_hash_temp[pHashWidth-1:0];
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_position  <= {lpPositionWidth{1'b0}};
+        end
+        else if (w_last_code_done) begin
+            r_position  <= {lpPositionWidth{1'b0}};
+        end
+        else if (w_shift && w_valid_buffer[lpHashIndex]) begin
+            r_position  <= r_position + {{(lpPositionWidth-1){1'b0}}, 1'b1};
+        end
+    end
+
+    lzss_ram #(
+        .pWidth (lpTotalHead    ),
+        .pDepth (lpHashSize     )
+    ) u_head_ram (
+        .clk        (clk                            ),
+        .i_we       (w_shift & r_read_valid         ),
+        .i_waddr    (r_read_hash                    ),
+        .i_wdata    (w_head_wdata                   ),
+        .i_re       (w_shift                        ),
+        .i_raddr    (w_hash                         ),
+        .o_rdata    (w_head_rdata                   )
+    );
+
+    //  直前の位置と同じハッシュの場合は書き込み前のデータが読み出されるため、書き込みデータを使用する
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_read_valid        <= 1'b0;
+            r_read_position     <= {lpPositionWidth{1'b0}};
+            r_read_hash         <= {pHashWidth{1'b0}};
+            r_read_bucket_valid <= 1'b0;
+            r_forward           <= 1'b0;
+            r_forward_head      <= {lpTotalHead{1'b0}};
+        end
+        else if (w_last_code_done) begin
+            r_read_valid        <= 1'b0;
+            r_read_position     <= {lpPositionWidth{1'b0}};
+            r_read_hash         <= {pHashWidth{1'b0}};
+            r_read_bucket_valid <= 1'b0;
+            r_forward           <= 1'b0;
+            r_forward_head      <= {lpTotalHead{1'b0}};
+        end
+        else if (w_shift) begin
+            r_read_valid        <= w_valid_buffer[lpHashIndex];
+            r_read_position     <= r_position;
+            r_read_hash         <= w_hash;
+            r_read_bucket_valid <= r_bucket_valid[w_hash];
+            r_forward           <= (w_hash == r_read_hash) & r_read_valid;
+            r_forward_head      <= w_head_wdata;
+        end
+    end
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_bucket_valid  <= {lpHashSize{1'b0}};
+        end
+        else if (w_last_code_done) begin
+            r_bucket_valid  <= {lpHashSize{1'b0}};
+        end
+        else if (w_shift && r_read_valid) begin
+            r_bucket_valid[r_read_hash] <= 1'b1;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  候補位置の判定/ハッシュヘッドテーブル更新/参照データ読み出し(lpReadIndex)
+//----------------------------------------------------------------------
+    assign  w_head          = (r_forward) ? r_forward_head : w_head_rdata;
+    assign  w_bucket_valid  = r_forward | r_read_bucket_valid;
+
+    generate
+        for (k = 0;k < pCandidates;k = k + 1) begin : candidate_loop
+            wire                            w_way_valid;
+            wire    [lpPositionWidth-1:0]   w_way_position;
+            wire    [lpRowBits-1:0]         w_row;
+            wire    [lpRowBits-1:0]         w_next_row;
+            wire    [lpRowWidth-1:0]        w_even_rdata;
+            wire    [lpRowWidth-1:0]        w_odd_rdata;
+            wire    [2*lpRowWidth-1:0]      w_rows;
+            wire    [lpMatchingData-1:0]    w_ref_data;
+            wire    [pCodingSize-1:0]       w_each_match;
+            wire    [pCodingSize-1:0]       w_sel;
+
+            //  新しい位置を先頭に挿入する
+            assign  w_way_valid     = w_bucket_valid & w_head[k*lpHeadWidth+lpPositionWidth];
+            assign  w_way_position  = w_head[k*lpHeadWidth+:lpPositionWidth];
+            if (k == 0) begin : first
+                assign  w_head_wdata[k*lpHeadWidth+:lpHeadWidth]    = {1'b1, r_read_position};
+            end
+            if (k < (pCandidates - 1)) begin : shift
+                assign  w_head_wdata[(k+1)*lpHeadWidth+:lpHeadWidth]    = {w_way_valid, w_way_position};
+            end
+
+            //  距離が1～pReferenceSizeの候補のみ比較する
+            assign  w_distance[k]   = r_read_position - w_way_position;
+            assign  w_candidate[k]  = r_read_valid & w_way_valid & (|w_distance[k]) & (w_distance[k] <= pReferenceSize);
+
+            //  参照データ(候補位置の行と次の行)
+            assign  w_row       = w_way_position[lpPositionWidth-1:lpLaneBits];
+            assign  w_next_row  = w_row + {{(lpRowBits-1){1'b0}}, 1'b1};
+
+            lzss_ram #(
+                .pWidth     (lpRowWidth     ),
+                .pDepth     (lpBankDepth    ),
+                .pLaneNum   (lpLaneNum      )
+            ) u_even_ram (
+                .clk        (clk                                ),
+                .i_we       (w_write_even                       ),
+                .i_waddr    (w_write_row[lpRowBits-1:1]         ),
+                .i_wdata    ({lpLaneNum{w_data_buffer[(lpBufferSize-1)*pDataWidth+:pDataWidth]}}),
+                .i_re       (w_shift                            ),
+                .i_raddr    (w_next_row[lpRowBits-1:1]          ),
+                .o_rdata    (w_even_rdata                       )
+            );
+            lzss_ram #(
+                .pWidth     (lpRowWidth     ),
+                .pDepth     (lpBankDepth    ),
+                .pLaneNum   (lpLaneNum      )
+            ) u_odd_ram (
+                .clk        (clk                                ),
+                .i_we       (w_write_odd                        ),
+                .i_waddr    (w_write_row[lpRowBits-1:1]         ),
+                .i_wdata    ({lpLaneNum{w_data_buffer[(lpBufferSize-1)*pDataWidth+:pDataWidth]}}),
+                .i_re       (w_shift                            ),
+                .i_raddr    (w_row[lpRowBits-1:1]               ),
+                .o_rdata    (w_odd_rdata                        )
+            );
+
+            always @(posedge clk or negedge rst_x) begin
+                if (!rst_x) begin
+                    r_match_candidate[k]    <= 1'b0;
+                    r_match_distance[k]     <= {lpPositionWidth{1'b0}};
+                    r_match_row_odd[k]      <= 1'b0;
+                    r_match_lane[k]         <= {lpLaneBits{1'b0}};
+                end
+                else if (w_last_code_done) begin
+                    r_match_candidate[k]    <= 1'b0;
+                    r_match_distance[k]     <= {lpPositionWidth{1'b0}};
+                    r_match_row_odd[k]      <= 1'b0;
+                    r_match_lane[k]         <= {lpLaneBits{1'b0}};
+                end
+                else if (w_shift) begin
+                    r_match_candidate[k]    <= w_candidate[k];
+                    r_match_distance[k]     <= w_distance[k];
+                    r_match_row_odd[k]      <= w_row[0];
+                    r_match_lane[k]         <= w_way_position[lpLaneBits-1:0];
+                end
+            end
+
+//----------------------------------------------------------------------
+//  一致比較(lpMatchIndex)
+//----------------------------------------------------------------------
+            //  候補位置の行を下位とした連続2行から取り出す
+            assign  w_rows      = (r_match_row_odd[k]) ? {w_even_rdata, w_odd_rdata} : {w_odd_rdata, w_even_rdata};
+            assign  w_ref_data  = w_rows[r_match_lane[k]*pDataWidth+:lpMatchingData];
+
+            for (i = 0;i < pCodingSize;i = i + 1) begin : matching_loop
+                assign  w_each_match[i] = (
+                    r_match_candidate[k] &&
+                    w_coding_valid[i] &&
+                    (w_ref_data[i*pDataWidth+:pDataWidth] == w_coding_data[i*pDataWidth+:pDataWidth])
+                ) ? 1'b1 : 1'b0;
+
+                if (i == 0) begin : first
+                    assign  w_match[k][i]   = w_each_match[i];
+                end
+                else begin : other
+                    assign  w_match[k][i]   = &w_each_match[i:0];
+                end
+
+                if (i == (pCodingSize - 1)) begin : last
+                    assign  w_sel[i]    = w_match[k][i];
+                end
+                else begin : other_sel
+                    assign  w_sel[i]    = w_match[k][i] & (~w_match[k][i+1]);
+                end
+            end
+
+            //  一致長(一致したデータ数)
+            for (i = 0;i < lpLengthWidth;i = i + 1) begin : length_loop1
+                wire    [pCodingSize-1:0]   w_length_temp;
+
+                assign  w_length[k][i]  = |(w_sel & w_length_temp);
+                for (j = 0;j < pCodingSize;j = j + 1) begin : length_loop2
+                    assign  w_length_temp[j]    = (j + 1) >> i;
+                end
+            end
+
+            //  同じ一致長の場合は新しい候補(kが小さい側)を選択
+            assign  w_best_length[k]    = (w_length[k] >= w_best_length[k+1]) ? w_length[k]     : w_best_length[k+1];
+            assign  w_best_distance[k]  = (w_length[k] >= w_best_length[k+1]) ? r_match_distance[k] : w_best_distance[k+1];
+            assign  w_best_match[k]     = (w_length[k] >= w_best_length[k+1]) ? w_match[k]      : w_best_match[k+1];
+        end
+    endgenerate
+
+    assign  w_coding_data                   = w_data_buffer[lpMatchIndex*pDataWidth+:lpMatchingData];
+    assign  w_coding_valid                  = w_valid_buffer[lpMatchIndex+:pCodingSize];
+    assign  w_coding_last                   = w_last_buffer[lpMatchIndex+:pCodingSize];
+    assign  w_best_length[pCandidates]      = {lpLengthWidth{1'b0}};
+    assign  w_best_distance[pCandidates]    = {lpPositionWidth{1'b0}};
+    assign  w_best_match[pCandidates]       = {pCodingSize{1'b0}};
+
+    //  符号化するデータにラストが含まれるか
+    assign  w_last  = (|(w_coding_last & w_best_match[0])) | w_coding_last[0];
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_out_length    <= {lpLengthWidth{1'b0}};
+            r_out_distance  <= {lpPositionWidth{1'b0}};
+            r_out_last      <= 1'b0;
+        end
+        else if (w_last_code_done) begin
+            r_out_length    <= {lpLengthWidth{1'b0}};
+            r_out_distance  <= {lpPositionWidth{1'b0}};
+            r_out_last      <= 1'b0;
+        end
+        else if (w_shift) begin
+            r_out_length    <= w_best_length[0];
+            r_out_distance  <= w_best_distance[0];
+            r_out_last      <= w_last;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  コード出力(lpOutputIndex)
+//----------------------------------------------------------------------
+    assign  w_start         = (~|r_shift_count) & w_valid_buffer[lpOutputIndex];
+    assign  w_out_match     = |r_out_length[lpLengthWidth-1:1];
+    assign  w_out_offset    = pReferenceSize - r_out_distance;
+    assign  w_out_length    = r_out_length - 2;
+    assign  w_out_data      = w_data_buffer[lpOutputIndex*pDataWidth+:pDataWidth];
+    assign  w_code          = (w_out_match) ? {1'b1, w_out_offset[lpOffsetWidth-1:0], w_out_length[lpCodeLengthWidth-1:0]}
+                                            : {{(pCodeWidth-pDataWidth){1'b0}}, w_out_data};
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_code  <= {pCodeWidth{1'b0}};
+            r_last  <= 1'b0;
+        end
+        else if (w_new_code) begin
+            r_code  <= w_code;
+            r_last  <= r_out_last;
+        end
+    end
+
+    assign  o_code  = r_code;
+    assign  o_last  = r_last;
+
+endmodule
@@ -9,6 +9,7 @@
  *
  *  @date   0.0.00  2012/07/05  T. Ishitani     coding start
  *  @date   0.0.01  2012/07/18  T. Ishitani     オフセットをlzss_enc_matchから出力するように変更
+ *  @date   0.0.02  2026/10/19  T. Ishitani     レジスタなし(pRegister = 0)の構成を追加
  */
 module lzss_enc_match #(
 //--type-------+name-------------------+value--------------------------+description
@@ -17,6 +18,7 @@ module lzss_enc_match #(
     parameter   pCodingSize             = 5,                            //!<    符号化部サイズ
     parameter   pOffsetWidth            = 6,                            //!<    オフセット幅
     parameter   pLengthWidth            = 3,                            //!<    一致長幅
+    parameter   pRegister               = 1,                            //!<    出力までのレジスタ(0:なし 1:2段)
     parameter   pTotalData              = pDataWidth * pCodingSize      //!<    入力総データ幅
 )(
 //--type-------+width------------------+name---------------------------+description
@@ -38,6 +40,7 @@ module lzss_enc_match #(
     wire        [pCodingSize-1:0]       w_each_match;
     wire        [pCodingSize-1:0]       w_match;
     reg         [pCodingSize-1:0]       r_match;
+    wire        [pCodingSize-1:0]       w_match_sel;
     wire        [pCodingSize-1:0]       w_sel;
     wire        [pLengthWidth-1:0]      w_length;
     wire                                w_last;
@@ -80,21 +83,23 @@ module lzss_enc_match #(
         end
     end
 
+    assign  w_match_sel = (pRegister) ? r_match : w_match;
+
 //----------------------------------------------------------------------
 //  出力生成
 //----------------------------------------------------------------------
     assign  o_offset    = pOffset[pOffsetWidth-1:0];
-    assign  o_length    = r_length;
-    assign  o_last      = r_last[1];
+    assign  o_length    = (pRegister) ? r_length  : w_length;
+    assign  o_last      = (pRegister) ? r_last[1] : w_last;
 
     //  一致長
     generate
         for (i = 0;i < pCodingSize;i = i + 1) begin : sel_loop
             if (i == (pCodingSize - 1)) begin : last
-                assign  w_sel[i]    = r_match[i];
+                assign  w_sel[i]    = w_match_sel[i];
             end
             else begin : other
-                assign  w_sel[i]    = r_match[i] & (~r_match[i+1]);
+                assign  w_sel[i]    = w_match_sel[i] & (~w_match_sel[i+1]);
             end
         end
 
@@ -0,0 +1,115 @@
+/**
+ *  @file   lzss_enc_queue.v
+ *  @brief  入力データキューモジュール
+ *
+ *  1サイクルで最大pPushNumエントリを書き込み、先頭から最大pPopNumエントリを取り出す。
+ *  書き込みは詰めた後の有効エントリの直後に行い、先頭pPopNumエントリを常に出力する。
+ *  i_push_keepは下位から連続した有効エントリを示す。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_enc_queue #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pWidth                  = 9,                            //!<    エントリ幅
+    parameter   pPushNum                = 1,                            //!<    最大書き込みエントリ数
+    parameter   pPopNum                 = 5,                            //!<    最大取り出しエントリ数
+    parameter   pDepth                  = pPushNum + pPopNum,           //!<    深さ
+    parameter   pPopCountWidth          = log2(pPopNum) + 1,            //!<    取り出し数幅
+    parameter   pInputWidth             = pWidth * pPushNum,            //!<    入力幅
+    parameter   pOutputWidth            = pWidth * pPopNum              //!<    出力幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    input                               i_clear,                        //!<    クリア
+    //  書き込み
+    input                               i_push,                         //!<    書き込み
+    output                              o_push_ready,                   //!<    書き込み可能(pPushNumエントリの空き)
+    input       [pPushNum-1:0]          i_push_keep,                    //!<    書き込みエントリ有効
+    input       [pInputWidth-1:0]       i_push_d,                       //!<    書き込みデータ(下位側が古いエントリ)
+    //  取り出し
+    input       [pPopCountWidth-1:0]    i_pop_count,                    //!<    取り出し数
+    output      [pPopNum-1:0]           o_valid,                        //!<    先頭エントリバリッド
+    output      [pOutputWidth-1:0]      o_d                             //!<    先頭エントリデータ
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpCountWidth            = log2(pDepth) + 1;
+    localparam  lpPushCountWidth        = log2(pPushNum) + 1;
+    localparam  lpTotalWidth            = pWidth * pDepth;
+
+//--type-------+width------------------+name---------------------------+description
+    reg         [lpCountWidth-1:0]      r_count;
+    wire        [lpCountWidth-1:0]      w_rest;
+    wire        [lpPushCountWidth-1:0]  w_push_count[0:pPushNum];
+    wire        [lpCountWidth-1:0]      w_push_num;
+    reg         [pWidth-1:0]            r_d[0:pDepth-1];
+    wire        [lpTotalWidth+pOutputWidth-1:0]
+                                        w_shift_d;
+    genvar                              i;
+
+//----------------------------------------------------------------------
+//  エントリ数
+//----------------------------------------------------------------------
+    assign  o_push_ready    = (r_count <= (pDepth - pPushNum)) ? 1'b1 : 1'b0;
+
+    //  取り出し後に残るエントリ数/書き込みエントリ数
+    assign  w_rest          = r_count - i_pop_count;
+    assign  w_push_count[0] = {lpPushCountWidth{1'b0}};
+    generate
+        for (i = 0;i < pPushNum;i = i + 1) begin : push_count_loop
+            assign  w_push_count[i+1]   = w_push_count[i] + i_push_keep[i];
+        end
+    endgenerate
+    assign  w_push_num      = (i_push) ? w_push_count[pPushNum] : {lpCountWidth{1'b0}};
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_count <= {lpCountWidth{1'b0}};
+        end
+        else if (i_clear) begin
+            r_count <= {lpCountWidth{1'b0}};
+        end
+        else begin
+            r_count <= w_rest + w_push_num;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  エントリ
+//----------------------------------------------------------------------
+    generate
+        for (i = 0;i < pDepth;i = i + 1) begin : entry_loop
+            assign  w_shift_d[i*pWidth+:pWidth] = r_d[i];
+
+            always @(posedge clk or negedge rst_x) begin
+                if (!rst_x) begin
+                    r_d[i]  <= {pWidth{1'b0}};
+                end
+                else if (i_clear) begin
+                    r_d[i]  <= {pWidth{1'b0}};
+                end
+                else if (i < w_rest) begin
+                    r_d[i]  <= w_shift_d[(i+i_pop_count)*pWidth+:pWidth];
+                end
+                else if ((i - w_rest) < w_push_num) begin
+                    r_d[i]  <= i_push_d[(i-w_rest)*pWidth+:pWidth];
+                end
+            end
+        end
+
+        for (i = 0;i < pPopNum;i = i + 1) begin : output_loop
+            assign  o_valid[i]              = (i < r_count) ? 1'b1 : 1'b0;
+            assign  o_d[i*pWidth+:pWidth]   = r_d[i];
+        end
+    endgenerate
+    assign  w_shift_d[lpTotalWidth+:pOutputWidth]  = {pOutputWidth{1'b0}};
+
+endmodule
@@ -2,6 +2,9 @@
  *  @file   lzss_enc_search.v
  *  @brief  最長一致系列検索モジュール
  *
+ *  pRegister段ごとに(根の段から)レジスタを入れる。pRegister = 0はレジスタなし。
+ *  入力から出力までのレジスタ段数はget_search_stages(pOffsetWidth, pRegister)。
+ *
  *  @par    Copyright
  *  (C) 2012 Taichi Ishitani All Rights Reserved.
  *
@@ -9,12 +12,15 @@
  *
  *  @date   0.0.00  2012/07/06  T. Ishitani     coding start
  *  @date   0.0.01  2012/07/18  T. Ishitani     オフセットをlzss_enc_matchから出力するように変更
+ *  @date   0.0.02  2026/10/19  T. Ishitani     レジスタなし(pRegister = 0)の構成を追加
+ *  @date   0.0.03  2026/10/19  T. Ishitani     pRegisterをレジスタを入れる段の間隔に変更
  */
 module lzss_enc_search #(
 //--type-------+name-------------------+value--------------------------+description
     parameter   pReferenceSize          = 64,                           //!<    参照部サイズ
     parameter   pOffsetWidth            = 6,                            //!<    オフセット幅
     parameter   pLengthWidth            = 3,                            //!<    一致長幅
+    parameter   pRegister               = 1,                            //!<    レジスタを入れる段の間隔(0:なし)
     parameter   pTotalOffset            = pOffsetWidth                  //!<    入力総オフセット幅
                                         * pReferenceSize,
     parameter   pTotalLength            = pLengthWidth                  //!<    入力総一致長幅
@@ -63,31 +69,43 @@ module lzss_enc_search #(
 
         for (i = 0;i < pOffsetWidth;i = i + 1) begin : search_loop1
             for (j = 0;j < (1 << i);j = j + 1) begin : search_loop2
-                assign  w_offset[((1<<i)-1)+j]  = r_offset[((1<<i)-1)+j];
-                assign  w_length[((1<<i)-1)+j]  = r_length[((1<<i)-1)+j];
-                assign    w_last[((1<<i)-1)+j]  =   r_last[((1<<i)-1)+j];
+                wire    w_sel;
 
-                always @(posedge clk or negedge rst_x) begin
-                    if (!rst_x) begin
-                        r_offset[((1<<i)-1)+j]  <= {pOffsetWidth{1'b0}};
-                        r_length[((1<<i)-1)+j]  <= {pLengthWidth{1'b0}};
-                          r_last[((1<<i)-1)+j]  <= 1'b0;
-                    end
-                    else if (i_clear) begin
-                        r_offset[((1<<i)-1)+j]  <= {pOffsetWidth{1'b0}};
-                        r_length[((1<<i)-1)+j]  <= {pLengthWidth{1'b0}};
-                          r_last[((1<<i)-1)+j]  <= 1'b0;
-                    end
-                    else if (i_update) begin
-                        if (w_length[((1<<(i+1))-1)+(2*j+1)] >= w_length[((1<<(i+1))-1)+(2*j+0)]) begin
-                            r_offset[((1<<i)-1)+j]  <= w_offset[((1<<(i+1))-1)+(2*j+1)];
-                            r_length[((1<<i)-1)+j]  <= w_length[((1<<(i+1))-1)+(2*j+1)];
-                              r_last[((1<<i)-1)+j]  <=   w_last[((1<<(i+1))-1)+(2*j+1)];
+                //  同じ一致長の場合は新しい側(上位)を選択
+                assign  w_sel   = (w_length[((1<<(i+1))-1)+(2*j+1)] >= w_length[((1<<(i+1))-1)+(2*j+0)]) ? 1'b1 : 1'b0;
+
+                if ((pRegister == 0) ? 1 : ((i % pRegister) != 0)) begin : no_register
+                    assign  w_offset[((1<<i)-1)+j]  = (w_sel) ? w_offset[((1<<(i+1))-1)+(2*j+1)] : w_offset[((1<<(i+1))-1)+(2*j+0)];
+                    assign  w_length[((1<<i)-1)+j]  = (w_sel) ? w_length[((1<<(i+1))-1)+(2*j+1)] : w_length[((1<<(i+1))-1)+(2*j+0)];
+                    assign    w_last[((1<<i)-1)+j]  = (w_sel) ?   w_last[((1<<(i+1))-1)+(2*j+1)] :   w_last[((1<<(i+1))-1)+(2*j+0)];
+                end
+                else begin : register
+                    assign  w_offset[((1<<i)-1)+j]  = r_offset[((1<<i)-1)+j];
+                    assign  w_length[((1<<i)-1)+j]  = r_length[((1<<i)-1)+j];
+                    assign    w_last[((1<<i)-1)+j]  =   r_last[((1<<i)-1)+j];
+
+                    always @(posedge clk or negedge rst_x) begin
+                        if (!rst_x) begin
+                            r_offset[((1<<i)-1)+j]  <= {pOffsetWidth{1'b0}};
+                            r_length[((1<<i)-1)+j]  <= {pLengthWidth{1'b0}};
+                              r_last[((1<<i)-1)+j]  <= 1'b0;
+                        end
+                        else if (i_clear) begin
+                            r_offset[((1<<i)-1)+j]  <= {pOffsetWidth{1'b0}};
+                            r_length[((1<<i)-1)+j]  <= {pLengthWidth{1'b0}};
+                              r_last[((1<<i)-1)+j]  <= 1'b0;
                         end
-                        else begin
-                            r_offset[((1<<i)-1)+j]  <= w_offset[((1<<(i+1))-1)+(2*j+0)];
-                            r_length[((1<<i)-1)+j]  <= w_length[((1<<(i+1))-1)+(2*j+0)];
-                              r_last[((1<<i)-1)+j]  <=   w_last[((1<<(i+1))-1)+(2*j+0)];
+                        else if (i_update) begin
+                            if (w_sel) begin
+                                r_offset[((1<<i)-1)+j]  <= w_offset[((1<<(i+1))-1)+(2*j+1)];
+                                r_length[((1<<i)-1)+j]  <= w_length[((1<<(i+1))-1)+(2*j+1)];
+                                  r_last[((1<<i)-1)+j]  <=   w_last[((1<<(i+1))-1)+(2*j+1)];
+                            end
+                            else begin
+                                r_offset[((1<<i)-1)+j]  <= w_offset[((1<<(i+1))-1)+(2*j+0)];
+                                r_length[((1<<i)-1)+j]  <= w_length[((1<<(i+1))-1)+(2*j+0)];
+                                  r_last[((1<<i)-1)+j]  <=   w_last[((1<<(i+1))-1)+(2*j+0)];
+                            end
                         end
                     end
                 end
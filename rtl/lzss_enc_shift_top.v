@@ -0,0 +1,339 @@
+/**
+ *  @file   lzss_enc_shift_top.v
+ *  @brief  LZSSエンコーダトップモジュール(1コード/サイクル)
+ *
+ *  符号化部の先頭位置だけを一致比較/検索(レジスタなし)し、
+ *  コードを出力したサイクルで一致長分(リテラルは1)だけ参照部をバレルシフトする。
+ *  入力データはlzss_enc_queueで受けて符号化部とし、符号化部が埋まるか
+ *  ラストが符号化部に入ればコードを生成する。
+ *  pBytesPerCycle(1/2/4/8)バイトを1サイクルで入力し、コードは1サイクルで1個出力する。
+ *  一致比較から検索、シフトまでが1サイクルのパスとなる。
+ *  pShiftRegister = 1ではシフト数をレジスタで受けて次のサイクルでシフトし、パスを
+ *  一致比較から検索まで(コード/シフト数のレジスタ)とシフト(バレルシフタ/キューの取り出し)に分ける。
+ *  シフトが終わるまで次のコードを生成しないため、コードは2サイクルで1個となる。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     pShiftRegisterを追加
+ */
+module lzss_enc_shift_top #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pDataWidth              = 8,                            //!<    データ幅
+    parameter   pReferenceSize          = 64,                           //!<    参照部サイズ
+    parameter   pCodingSize             = 5,                            //!<    符号化部サイズ
+    parameter   pBytesPerCycle          = 1,                            //!<    1サイクルの入力データ数
+    parameter   pShiftRegister          = 0,                            //!<    シフト数のレジスタ(0:なし 1:あり)
+    parameter   pCodeWidth              = get_code_width(               //!<    コード幅
+                                            pDataWidth,
+                                            pReferenceSize,
+                                            pCodingSize
+                                          ),
+    parameter   pInputWidth             = pDataWidth * pBytesPerCycle   //!<    入力データバス幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  データ入力
+    input                               i_valid,                        //!<    入力データバリッド
+    output                              ow_ready,                       //!<    入力データレディ
+    input       [pInputWidth-1:0]       i_data,                         //!<    入力データ(下位レーンが先)
+    input       [pBytesPerCycle-1:0]    i_keep,                         //!<    入力データ有効レーン
+    input                               i_last,                         //!<    入力データラスト
+    //  コード出力
+    output                              o_valid,                        //!<    出力コードバリッド
+    input                               i_ready,                        //!<    出力コードレディ
+    output      [pCodeWidth-1:0]        o_code,                         //!<    出力コード
+    output                              o_last                          //!<    出力コードラスト
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpLanes                 = pBytesPerCycle;
+    localparam  lpOffsetWidth           = log2(pReferenceSize);
+    localparam  lpLengthWidth           = log2(pCodingSize) + 1;
+    localparam  lpEntryWidth            = pDataWidth + 1;
+    //  最大シフト(pCodingSize)後も符号化部が埋まるように空きを判定する
+    localparam  lpQueueSize             = 2 * pCodingSize + lpLanes - 1;
+    localparam  lpWindowSize            = pReferenceSize + pCodingSize;
+    localparam  lpMatchingData          = pCodingSize    * pDataWidth;
+    localparam  lpTotalData             = lpWindowSize   * pDataWidth;
+    localparam  lpReferenceData         = pReferenceSize * pDataWidth;
+    localparam  lpTotalOffset           = pReferenceSize * lpOffsetWidth;
+    localparam  lpTotalLength           = pReferenceSize * lpLengthWidth;
+
+//--type-------+width------------------+name---------------------------+description
+    wire                                w_ready;
+    reg                                 r_valid;
+    wire                                w_in_ack;
+    wire                                w_out_ack;
+    wire                                w_push_ready;
+    wire                                w_coding_ready;
+    wire                                w_new_code;
+    wire        [lpLengthWidth-1:0]     w_shift_count;
+    wire                                w_shift;
+    wire        [lpLengthWidth-1:0]     w_shift_amount;
+    wire                                w_shift_wait;
+    reg                                 r_shift;
+    reg         [lpLengthWidth-1:0]     r_shift_count;
+    wire        [lpLengthWidth-1:0]     w_pop_count;
+    reg                                 r_last_data_done;
+    wire                                w_last_code_done;
+    wire        [lpEntryWidth*lpLanes-1:0]
+                                        w_in_entry;
+    wire        [pCodingSize-1:0]       w_coding_valid;
+    wire        [lpEntryWidth*pCodingSize-1:0]
+                                        w_coding_entry;
+    wire        [lpMatchingData-1:0]    w_coding_data;
+    wire        [pCodingSize-1:0]       w_coding_last;
+    wire        [pReferenceSize-1:0]    w_reference_valid;
+    wire        [lpReferenceData-1:0]   w_reference_data;
+    wire        [lpWindowSize-1:0]      w_valid_buffer;
+    wire        [lpTotalData-1:0]       w_data_buffer;
+    wire        [lpTotalOffset-1:0]     w_each_offset;
+    wire        [lpTotalLength-1:0]     w_each_length;
+    wire        [pReferenceSize-1:0]    w_each_last;
+    wire        [lpOffsetWidth-1:0]     w_offset;
+    wire        [lpLengthWidth-1:0]     w_length;
+    wire                                w_last;
+    wire                                w_match;
+    wire        [lpLengthWidth-2:0]     w_out_length;
+    wire        [pCodeWidth-1:0]        w_code;
+    reg         [pCodeWidth-1:0]        r_code;
+    reg                                 r_last;
+    genvar                              i;
+
+//----------------------------------------------------------------------
+//  入出力ハンドシェイク
+//----------------------------------------------------------------------
+    assign  ow_ready    = w_ready;
+    assign  o_valid     = r_valid;
+
+    assign  w_ready     = w_push_ready & (~r_last_data_done);
+    assign  w_in_ack    = i_valid & w_ready;
+    assign  w_out_ack   = r_valid & i_ready;
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_valid <= 1'b0;
+        end
+        else if (w_new_code) begin
+            r_valid <= 1'b1;
+        end
+        else if (w_out_ack) begin
+            r_valid <= 1'b0;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  シフト/出力タイミング制御
+//----------------------------------------------------------------------
+    //  符号化部が埋まっているか、ラストが符号化部にある
+    assign  w_coding_ready      = w_coding_valid[0] & (w_coding_valid[pCodingSize-1] | (|w_coding_last));
+    assign  w_new_code          = w_coding_ready & (w_out_ack | (~r_valid)) & (~w_shift_wait);
+    assign  w_last_code_done    = w_out_ack & r_last;
+
+    //  一致長(一致なしは0)+1バイト分シフトする
+    assign  w_shift_count       = w_length + {{(lpLengthWidth-1){1'b0}}, 1'b1};
+    assign  w_pop_count         = (w_shift) ? w_shift_amount : {lpLengthWidth{1'b0}};
+
+    //  pShiftRegister = 1ではコードを生成した次のサイクルでシフトする
+    //  (シフトするエントリは符号化部の先頭で、その間の入力はその後ろに入るため変わらない)
+    generate
+        if (pShiftRegister) begin : shift_register
+            assign  w_shift         = r_shift;
+            assign  w_shift_amount  = r_shift_count;
+            assign  w_shift_wait    = r_shift;
+        end
+        else begin : shift_direct
+            assign  w_shift         = w_new_code;
+            assign  w_shift_amount  = w_shift_count;
+            assign  w_shift_wait    = 1'b0;
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_shift         <= 1'b0;
+            r_shift_count   <= {lpLengthWidth{1'b0}};
+        end
+        else if (w_last_code_done) begin
+            r_shift         <= 1'b0;
+            r_shift_count   <= {lpLengthWidth{1'b0}};
+        end
+        else begin
+            r_shift         <= w_new_code;
+            r_shift_count   <= w_shift_count;
+        end
+    end
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_last_data_done    <= 1'b0;
+        end
+        else if (w_last_code_done) begin
+            r_last_data_done    <= 1'b0;
+        end
+        else if (w_in_ack && i_last) begin
+            r_last_data_done    <= 1'b1;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  符号化部(入力キュー)
+//----------------------------------------------------------------------
+    //  エントリは{ラスト, データ}、ラストは最上位の有効レーンに付ける
+    generate
+        for (i = 0;i < lpLanes;i = i + 1) begin : in_lane_loop
+            if (i == (lpLanes - 1)) begin : last
+                assign  w_in_entry[i*lpEntryWidth+:lpEntryWidth]    = {i_last, i_data[i*pDataWidth+:pDataWidth]};
+            end
+            else begin : other
+                assign  w_in_entry[i*lpEntryWidth+:lpEntryWidth]    = {i_last & (~i_keep[i+1]), i_data[i*pDataWidth+:pDataWidth]};
+            end
+        end
+    endgenerate
+
+    lzss_enc_queue #(
+        .pWidth     (lpEntryWidth   ),
+        .pPushNum   (lpLanes        ),
+        .pPopNum    (pCodingSize    ),
+        .pDepth     (lpQueueSize    )
+    ) u_queue (
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_code_done   ),
+        .i_push         (w_in_ack           ),
+        .o_push_ready   (w_push_ready       ),
+        .i_push_keep    (i_keep             ),
+        .i_push_d       (w_in_entry         ),
+        .i_pop_count    (w_pop_count        ),
+        .o_valid        (w_coding_valid     ),
+        .o_d            (w_coding_entry     )
+    );
+
+    generate
+        for (i = 0;i < pCodingSize;i = i + 1) begin : coding_loop
+            assign  w_coding_data[i*pDataWidth+:pDataWidth] = w_coding_entry[i*lpEntryWidth+:pDataWidth];
+            assign  w_coding_last[i]                        = w_coding_entry[i*lpEntryWidth+pDataWidth] & w_coding_valid[i];
+        end
+    endgenerate
+
+//----------------------------------------------------------------------
+//  参照部(符号化部の先頭から一致長分をバレルシフトで取り込む)
+//----------------------------------------------------------------------
+    //  バリッド
+    lzss_buffer #(
+        .pWidth         (1              ),
+        .pDepth         (pReferenceSize ),
+        .pShift         (pCodingSize    ),
+        .pVariableShift (1              )
+    ) u_valid_buffer (
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_code_done   ),
+        .i_shift        (w_shift            ),
+        .i_shift_count  (w_shift_amount     ),
+        .i_d            (w_coding_valid     ),
+        .o_d            (w_reference_valid  )
+    );
+    //  データ
+    lzss_buffer #(
+        .pWidth         (pDataWidth     ),
+        .pDepth         (pReferenceSize ),
+        .pShift         (pCodingSize    ),
+        .pVariableShift (1              )
+    ) u_data_buffer (
+        .clk            (clk                ),
+        .rst_x          (rst_x              ),
+        .i_clear        (w_last_code_done   ),
+        .i_shift        (w_shift            ),
+        .i_shift_count  (w_shift_amount     ),
+        .i_d            (w_coding_data      ),
+        .o_d            (w_reference_data   )
+    );
+
+    assign  w_valid_buffer  = {w_coding_valid, w_reference_valid};
+    assign  w_data_buffer   = {w_coding_data,  w_reference_data };
+
+//----------------------------------------------------------------------
+//  最長一致系列検索(レジスタなし)
+//----------------------------------------------------------------------
+    //  一致比較
+    generate
+        for (i = 0;i < pReferenceSize;i = i + 1) begin : matching_loop
+            lzss_enc_match #(
+                .pOffset        (i              ),
+                .pDataWidth     (pDataWidth     ),
+                .pCodingSize    (pCodingSize    ),
+                .pOffsetWidth   (lpOffsetWidth  ),
+                .pLengthWidth   (lpLengthWidth  ),
+                .pRegister      (0              )
+            ) u_match (
+                .clk            (clk                                            ),
+                .rst_x          (rst_x                                          ),
+                .i_update       (1'b0                                           ),
+                .i_clear        (1'b0                                           ),
+                .i_valid        (w_coding_valid                                 ),
+                .i_data         (w_coding_data                                  ),
+                .i_last         (w_coding_last                                  ),
+                .i_ref_valid    (w_valid_buffer[i+:pCodingSize]                 ),
+                .i_ref_data     (w_data_buffer[i*pDataWidth+:lpMatchingData]    ),
+                .o_offset       (w_each_offset[i*lpOffsetWidth+:lpOffsetWidth]  ),
+                .o_length       (w_each_length[i*lpLengthWidth+:lpLengthWidth]  ),
+                .o_last         (w_each_last[i]                                 )
+            );
+        end
+    endgenerate
+
+    //  検索
+    lzss_enc_search #(
+        .pReferenceSize (pReferenceSize ),
+        .pOffsetWidth   (lpOffsetWidth  ),
+        .pLengthWidth   (lpLengthWidth  ),
+        .pRegister      (0              )
+    ) u_search (
+        .clk        (clk            ),
+        .rst_x      (rst_x          ),
+        .i_update   (1'b0           ),
+        .i_clear    (1'b0           ),
+        .i_offset   (w_each_offset  ),
+        .i_length   (w_each_length  ),
+        .i_last     (w_each_last    ),
+        .o_offset   (w_offset       ),
+        .o_length   (w_length       ),
+        .o_last     (w_last         )
+    );
+
+//----------------------------------------------------------------------
+//  エンコード
+//----------------------------------------------------------------------
+    assign  o_code  = r_code;
+    assign  o_last  = r_last;
+
+    assign  w_match         = |w_length;
+    assign  w_out_length    = w_length[lpLengthWidth-2:0] + {(lpLengthWidth-1){1'b1}};
+    assign  w_code          = (w_match) ? {1'b1, w_offset, w_out_length}
+                                        : {{(pCodeWidth-pDataWidth){1'b0}}, w_coding_data[pDataWidth-1:0]};
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_code  <= {pCodeWidth{1'b0}};
+            r_last  <= 1'b0;
+        end
+        else if (w_last_code_done) begin
+            r_code  <= {pCodeWidth{1'b0}};
+            r_last  <= 1'b0;
+        end
+        else if (w_new_code) begin
+            r_code  <= w_code;
+            r_last  <= w_last;
+        end
+    end
+
+endmodule
@@ -2,6 +2,22 @@
  *  @file   lzss_enc_top.v
  *  @brief  LZSSエンコーダトップモジュール
  *
+ *  pBytesPerCycle(1/2/4/8)バイトを1サイクルで入力する。
+ *  連続するpBytesPerCycle個の符号化開始位置それぞれに一致比較/検索を持ち、
+ *  1サイクルで最大pBytesPerCycle個のコードを下位レーンから詰めて出力する。
+ *  i_keep/o_keepは下位レーンから連続した有効レーンを示す(i_keepが全レーン有効でないのはラストのみ)。
+ *  バッファの各エントリにフレームタグを持ち、一致比較は符号化位置と同じタグのエントリとのみ行う。
+ *  前のフレームの出力を待たずに次のフレームを入力でき、フレーム間の入力がない間は
+ *  バッファに有効エントリが残っていればシフトを続ける(前のフレームを掃き出す)。
+ *  次のフレームのタグが参照部/符号化部に残っている間は次のフレームの入力を待たせる
+ *  (pFrameTagWidthの既定値は参照部/符号化部の全エントリを区別できる幅で、この待ちは発生しない)。
+ *  pEarlyLiterals > 0の場合はフレームの先頭pEarlyLiteralsバイトを入力と同時にリテラルとして出力し、
+ *  符号化部が埋まるのを待たずに最初のコードを出す(Lzssのearly_literalsと同じコード列)。
+ *  このときフレームの先頭は前のフレームのコード出力完了まで待たせる。
+ *  pSearchRegisterIntervalは検索のレジスタを入れる段の間隔(lzss_enc_searchのpRegister)で、
+ *  大きくするほどレイテンシが減り、段間の組み合わせ回路が長くなる。
+ *  pPerfCounter = 1の場合は入出力を観測する性能カウンタ(lzss_perf_counter)を持つ。
+ *
  *  @par    Copyright
  *  (C) 2012 Taichi Ishitani All Rights Reserved.
  *
@@ -9,17 +25,30 @@
  *
  *  @date   0.0.00  2012/07/05  T. Ishitani     coding start
  *  @date   0.0.01  2012/07/18  T. Ishitani     オフセットをlzss_enc_matchから出力するように変更
+ *  @date   0.0.02  2026/10/19  T. Ishitani     pBytesPerCycle追加
+ *  @date   0.0.03  2026/10/19  T. Ishitani     フレームタグによるフレームの連続入力に変更
+ *  @date   0.0.04  2026/10/19  T. Ishitani     pEarlyLiterals/pSearchRegisterInterval追加
+ *  @date   0.0.05  2026/10/19  T. Ishitani     性能カウンタ(pPerfCounter)追加
  */
 module lzss_enc_top #(
 //--type-------+name-------------------+value--------------------------+description
     parameter   pDataWidth              = 8,                            //!<    データ幅
     parameter   pReferenceSize          = 64,                           //!<    参照部サイズ
     parameter   pCodingSize             = 5,                            //!<    符号化部サイズ
+    parameter   pBytesPerCycle          = 1,                            //!<    1サイクルの入力データ数
+    parameter   pFrameTagWidth          = log2(                         //!<    フレームタグ幅
+                                            pReferenceSize + pCodingSize - 1
+                                          ) + 1,
+    parameter   pEarlyLiterals          = 0,                            //!<    フレーム先頭の早期リテラル数
+    parameter   pSearchRegisterInterval = 1,                            //!<    検索のレジスタを入れる段の間隔(0:なし)
+    parameter   pPerfCounter            = 0,                            //!<    性能カウンタ(0:なし 1:あり)
     parameter   pCodeWidth              = get_code_width(               //!<    コード幅
                                             pDataWidth,
                                             pReferenceSize,
                                             pCodingSize
-                                          )
+                                          ),
+    parameter   pInputWidth             = pDataWidth * pBytesPerCycle,  //!<    入力データバス幅
+    parameter   pOutputWidth            = pCodeWidth * pBytesPerCycle   //!<    出力コードバス幅
 )(
 //--type-------+width------------------+name---------------------------+description
     //  システム
@@ -28,28 +57,54 @@ module lzss_enc_top #(
     //  データ入力
     input                               i_valid,                        //!<    入力データバリッド
     output                              ow_ready,                       //!<    入力データレディ
-    input       [pDataWidth-1:0]        i_data,                         //!<    入力データ
+    input       [pInputWidth-1:0]       i_data,                         //!<    入力データ(下位レーンが先)
+    input       [pBytesPerCycle-1:0]    i_keep,                         //!<    入力データ有効レーン
     input                               i_last,                         //!<    入力データラスト
     //  コード出力
     output                              o_valid,                        //!<    出力コードバリッド
     input                               i_ready,                        //!<    出力コードレディ
-    output      [pCodeWidth-1:0]        o_code,                         //!<    出力コード
-    output                              o_last                          //!<    出力コードラスト
+    output      [pOutputWidth-1:0]      o_code,                         //!<    出力コード(下位レーンが先)
+    output      [pBytesPerCycle-1:0]    o_keep,                         //!<    出力コード有効レーン
+    output                              o_last,                         //!<    出力コードラスト
+    //  性能カウンタ(pPerfCounter = 1のみ、lzss_perf_counter.v参照)
+    input                               i_psel,                         //!<    セレクト
+    input                               i_penable,                      //!<    イネーブル
+    input                               i_pwrite,                       //!<    ライト
+    input       [7:0]                   i_paddr,                        //!<    アドレス
+    input       [31:0]                  i_pwdata,                       //!<    ライトデータ
+    output      [31:0]                  o_prdata,                       //!<    リードデータ
+    output                              o_pready                        //!<    レディ
 );
 
     `include "lzss_function.vh"
 
 //--type-------+name-------------------+value--------------------------+description
-    localparam  lpWindowSize            = pReferenceSize + pCodingSize;
+    localparam  lpLanes                 = pBytesPerCycle;
     localparam  lpOffsetWidth           = log2(pReferenceSize);
     localparam  lpLengthWidth           = log2(pCodingSize) + 1;
+    localparam  lpLaneWidth             = log2(lpLanes) + 1;
+    localparam  lpEarlyWidth            = log2(pEarlyLiterals + 1) + 1;
+    //  一致比較(2段)+検索(lpSearchStages段)の間に進むエントリ数
+    localparam  lpSearchStages          = get_search_stages(lpOffsetWidth, pSearchRegisterInterval);
+    localparam  lpLatency               = lpLanes * (lpSearchStages + 2);
+    //  出力データを取り出すためにバッファの参照部より古い側に追加するエントリ数
+    localparam  lpHistorySize           = (lpLatency > pReferenceSize) ? lpLatency - pReferenceSize : 0;
+    localparam  lpBufferSize            = lpHistorySize
+                                        + pReferenceSize
+                                        + pCodingSize
+                                        + lpLanes - 1;
+    localparam  lpLastBufferSize        = pCodingSize + lpLanes - 1;
+    //  出力位置のレーンが入力ビートの境界をまたぐ場合はフレーム間に空きシフトを1回入れる
+    localparam  lpFrameGap              = (((pCodingSize - 1) % lpLanes) != 0) ? 1 : 0;
+    localparam  lpCodingIndex           = lpHistorySize + pReferenceSize;
+    localparam  lpOutputIndex           = lpCodingIndex - lpLatency;
     localparam  lpMatchingData          = pCodingSize    * pDataWidth;
-    localparam  lpTotalData             = lpWindowSize   * pDataWidth;
+    localparam  lpTotalData             = lpBufferSize   * pDataWidth;
     localparam  lpTotalOffset           = pReferenceSize * lpOffsetWidth;
     localparam  lpTotalLength           = pReferenceSize * lpLengthWidth;
-    localparam  lpOutputIndex           = pReferenceSize
-                                        - lpOffsetWidth
-                                        - 2;
+    localparam  lpTotalTag              = lpBufferSize   * pFrameTagWidth;
+    localparam  lpRegisterDepth         = lpBufferSize   - lpLanes;
+    localparam  lpHistogramBins         = (lpLengthWidth > 5) ? 16 : (1 << (lpLengthWidth - 1));
 
 //--type-------+width------------------+name---------------------------+description
     wire                                w_ready;
@@ -60,29 +115,43 @@ module lzss_enc_top #(
     wire                                w_shift_enable;
     wire                                w_shift;
     reg         [lpLengthWidth-1:0]     r_shift_count;
-    wire                                w_shift_count_ne_0;
-    wire                                w_shift_count_eq_0;
-    reg                                 r_last_data_done;
-    wire                                w_last_code_done;
-    wire                                w_in_valid;
-    wire        [lpWindowSize-1:0]      w_valid_buffer;
+    wire                                w_flush;
+    reg                                 r_open;
+    reg                                 r_gap;
+    reg         [pFrameTagWidth-1:0]    r_tag;
+    wire        [pFrameTagWidth-1:0]    w_in_tag;
+    wire        [lpRegisterDepth-1:0]   w_tag_used;
+    wire                                w_new_frame_wait;
+    wire                                w_idle;
+    reg         [lpEarlyWidth-1:0]      r_early_count;
+    wire        [lpEarlyWidth-1:0]      w_early_count;
+    wire        [lpLanes-1:0]           w_in_early;
+    wire                                w_early_wait;
+    wire                                w_early_code;
+    wire        [lpBufferSize-1:0]      w_early_buffer;
+    wire        [lpLanes-1:0]           w_in_valid;
+    wire        [lpLanes-1:0]           w_in_last;
+    wire        [lpBufferSize-1:0]      w_valid_buffer;
+    wire        [lpTotalTag-1:0]        w_tag_buffer;
     wire        [lpTotalData-1:0]       w_data_buffer;
-    wire        [pCodingSize-1:0]       w_last_buffer;
-    wire        [lpTotalOffset-1:0]     w_each_offset;
-    wire        [lpTotalLength-1:0]     w_each_length;
-    wire        [pReferenceSize-1:0]    w_each_last;
-    wire        [lpOffsetWidth-1:0]     w_offset;
-    wire        [lpLengthWidth-1:0]     w_length;
-    wire                                w_last;
-    wire                                w_match;
-    wire        [lpLengthWidth-2:0]     w_out_length;
-    wire        [pDataWidth-1:0]        w_out_data;
-    wire        [pCodeWidth-1:0]        w_match_code;
-    wire        [pCodeWidth-1:0]        w_unmatch_code;
-    wire        [pCodeWidth-1:0]        w_code;
-    reg         [pCodeWidth-1:0]        r_code;
+    wire        [lpLastBufferSize-1:0]  w_last_buffer;
+    wire        [lpOffsetWidth-1:0]     w_offset[0:lpLanes-1];
+    wire        [lpLengthWidth-1:0]     w_length[0:lpLanes-1];
+    wire        [lpLanes-1:0]           w_last;
+    wire        [lpLanes-1:0]           w_out_valid;
+    wire        [lpLengthWidth-1:0]     w_skip[0:lpLanes];
+    wire        [lpLanes-1:0]           w_start;
+    wire        [lpLaneWidth-1:0]       w_slot[0:lpLanes];
+    wire        [pCodeWidth-1:0]        w_lane_code[0:lpLanes-1];
+    wire        [pOutputWidth-1:0]      w_code;
+    wire        [lpLanes-1:0]           w_keep;
+    wire        [pOutputWidth-1:0]      w_early_data;
+    reg         [pOutputWidth-1:0]      r_code;
+    reg         [lpLanes-1:0]           r_keep;
     reg                                 r_last;
     genvar                              i;
+    genvar                              j;
+    genvar                              k;
 
 //----------------------------------------------------------------------
 //  入出力ハンドシェイク
@@ -90,7 +159,7 @@ module lzss_enc_top #(
     assign  ow_ready    = w_ready;
     assign  o_valid     = r_valid;
 
-    assign  w_ready     = w_shift_enable & (~r_last_data_done);
+    assign  w_ready     = w_shift_enable & (~w_new_frame_wait) & (~w_early_wait);
     assign  w_in_ack    = i_valid & w_ready;
     assign  w_out_ack   = r_valid & i_ready;
 
@@ -98,7 +167,7 @@ module lzss_enc_top #(
         if (!rst_x) begin
             r_valid <= 1'b0;
         end
-        else if (w_new_code) begin
+        else if (w_new_code || w_early_code) begin
             r_valid <= 1'b1;
         end
         else if (w_out_ack) begin
@@ -109,154 +178,347 @@ module lzss_enc_top #(
 //----------------------------------------------------------------------
 //  バッファ更新タイミング/出力タイミング制御
 //----------------------------------------------------------------------
-    assign  w_shift_enable      = w_shift_count_ne_0 | (w_shift_count_eq_0 & (w_out_ack | (~r_valid)));
-    assign  w_shift             = w_shift_enable & (w_in_ack | r_last_data_done);
-    assign  w_new_code          = w_shift_count_eq_0 & w_shift & w_valid_buffer[lpOutputIndex];
-    assign  w_last_code_done    = w_out_ack & r_last;
+    //  コードを生成しないシフトは出力の空きを待たない
+    //  フレーム間(r_open = 0)は入力がなくてもバッファに有効エントリがあればシフトする
+    assign  w_shift_enable      = (~(|w_start)) | w_out_ack | (~r_valid);
+    assign  w_shift             = w_shift_enable & (w_in_ack | w_flush);
+    assign  w_flush             = (~r_open) & (|w_valid_buffer[lpRegisterDepth-1:0]);
+    assign  w_new_code          = w_shift & (|w_start);
 
-    assign  w_shift_count_ne_0  = |r_shift_count;
-    assign  w_shift_count_eq_0  = ~w_shift_count_ne_0;
     always @(posedge clk or negedge rst_x) begin
         if (!rst_x) begin
             r_shift_count   <= {lpLengthWidth{1'b0}};
         end
-        else if (w_last_code_done) begin
-            r_shift_count   <= {lpLengthWidth{1'b0}};
+        else if (w_shift) begin
+            r_shift_count   <= w_skip[lpLanes];
         end
-        else if (w_new_code) begin
-            r_shift_count   <= w_length;
+    end
+
+//----------------------------------------------------------------------
+//  フレームタグ
+//----------------------------------------------------------------------
+    //  新しいフレームはr_tag + 1を使用する
+    assign  w_in_tag            = (r_open) ? r_tag : r_tag + {{(pFrameTagWidth-1){1'b0}}, 1'b1};
+    assign  w_new_frame_wait    = (~r_open) & (r_gap | (|w_tag_used));
+
+    generate
+        //  参照部より古いエントリは比較に使用しない
+        for (i = 0;i < lpRegisterDepth;i = i + 1) begin : tag_used_loop
+            if (i < lpHistorySize) begin : history
+                assign  w_tag_used[i]   = 1'b0;
+            end
+            else begin : reference
+                assign  w_tag_used[i]   = w_valid_buffer[i] & (w_tag_buffer[i*pFrameTagWidth+:pFrameTagWidth] == w_in_tag);
+            end
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_open  <= 1'b0;
+            r_tag   <= {pFrameTagWidth{1'b0}};
         end
-        else if (w_shift && w_shift_count_ne_0) begin
-            r_shift_count   <= r_shift_count + {lpLengthWidth{1'b1}};
+        else if (w_in_ack) begin
+            r_open  <= ~i_last;
+            r_tag   <= w_in_tag;
         end
     end
 
     always @(posedge clk or negedge rst_x) begin
         if (!rst_x) begin
-            r_last_data_done    <= 1'b0;
-        end
-        else if (w_last_code_done) begin
-            r_last_data_done    <= 1'b0;
+            r_gap   <= 1'b0;
         end
         else if (w_in_ack && i_last) begin
-            r_last_data_done    <= 1'b1;
+            r_gap   <= (lpFrameGap) ? 1'b1 : 1'b0;
+        end
+        else if (w_shift) begin
+            r_gap   <= 1'b0;
+        end
+    end
+
+//----------------------------------------------------------------------
+//  早期リテラル
+//----------------------------------------------------------------------
+    //  フレームの先頭は前のフレームのコードがすべて出力されるまで待つ
+    //  (出力位置以降に有効エントリがなく、出力レジスタが空く)
+    assign  w_idle          = (~(|w_valid_buffer[lpRegisterDepth-1:lpOutputIndex])) & ((~r_valid) | w_out_ack);
+    assign  w_early_count   = (r_open) ? r_early_count : pEarlyLiterals;
+    //  早期リテラルを含むビートは出力レジスタの空きを待つ
+    assign  w_early_wait    = (~w_in_early[0]) ? 1'b0
+                            : (r_open        ) ? r_valid & (~w_out_ack)
+                                               : ~w_idle;
+    assign  w_early_code    = w_in_ack & w_in_early[0];
+
+    generate
+        for (i = 0;i < lpLanes;i = i + 1) begin : early_loop
+            assign  w_in_early[i]   = (w_early_count > i) ? 1'b1 : 1'b0;
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_early_count   <= {lpEarlyWidth{1'b0}};
+        end
+        else if (w_in_ack) begin
+            r_early_count   <= (w_early_count > lpLanes) ? w_early_count - lpLanes : {lpEarlyWidth{1'b0}};
         end
     end
 
 //----------------------------------------------------------------------
 //  バッファ
 //----------------------------------------------------------------------
+    //  レーンごとのバリッド/ラスト(ラストは最上位の有効レーンに付ける)
+    generate
+        for (i = 0;i < lpLanes;i = i + 1) begin : in_lane_loop
+            assign  w_in_valid[i]   = w_in_ack & i_keep[i];
+            if (i == (lpLanes - 1)) begin : last
+                assign  w_in_last[i]    = w_in_valid[i] & i_last;
+            end
+            else begin : other
+                assign  w_in_last[i]    = w_in_valid[i] & i_last & (~i_keep[i+1]);
+            end
+        end
+    endgenerate
+
     //  バリッド
-    assign  w_in_valid  = i_valid & (~r_last_data_done);
     lzss_buffer #(
         .pWidth (1              ),
-        .pDepth (lpWindowSize   )
+        .pDepth (lpBufferSize   ),
+        .pShift (lpLanes        )
     ) u_valid_buffer (
-        .clk        (clk                ),
-        .rst_x      (rst_x              ),
-        .i_clear    (w_last_code_done   ),
-        .i_shift    (w_shift            ),
-        .i_d        (w_in_valid         ),
-        .o_d        (w_valid_buffer     )
+        .clk            (clk                    ),
+        .rst_x          (rst_x                  ),
+        .i_clear        (1'b0                   ),
+        .i_shift        (w_shift                ),
+        .i_shift_count  ({lpLaneWidth{1'b0}}    ),
+        .i_d            (w_in_valid             ),
+        .o_d            (w_valid_buffer         )
     );
     //  データ
     lzss_buffer #(
         .pWidth (pDataWidth     ),
-        .pDepth (lpWindowSize   )
+        .pDepth (lpBufferSize   ),
+        .pShift (lpLanes        )
     ) u_data_buffer (
-        .clk        (clk                ),
-        .rst_x      (rst_x              ),
-        .i_clear    (w_last_code_done   ),
-        .i_shift    (w_shift            ),
-        .i_d        (i_data             ),
-        .o_d        (w_data_buffer      )
+        .clk            (clk                    ),
+        .rst_x          (rst_x                  ),
+        .i_clear        (1'b0                   ),
+        .i_shift        (w_shift                ),
+        .i_shift_count  ({lpLaneWidth{1'b0}}    ),
+        .i_d            (i_data                 ),
+        .o_d            (w_data_buffer          )
     );
-    //  ラスト
+    //  フレームタグ
+    lzss_buffer #(
+        .pWidth (pFrameTagWidth ),
+        .pDepth (lpBufferSize   ),
+        .pShift (lpLanes        )
+    ) u_tag_buffer (
+        .clk            (clk                            ),
+        .rst_x          (rst_x                          ),
+        .i_clear        (1'b0                           ),
+        .i_shift        (w_shift                        ),
+        .i_shift_count  ({lpLaneWidth{1'b0}}            ),
+        .i_d            ({lpLanes{w_in_tag}}            ),
+        .o_d            (w_tag_buffer                   )
+    );
+    //  早期リテラル(出力済み)
     lzss_buffer #(
         .pWidth (1              ),
-        .pDepth (pCodingSize    )
+        .pDepth (lpBufferSize   ),
+        .pShift (lpLanes        )
+    ) u_early_buffer (
+        .clk            (clk                        ),
+        .rst_x          (rst_x                      ),
+        .i_clear        (1'b0                       ),
+        .i_shift        (w_shift                    ),
+        .i_shift_count  ({lpLaneWidth{1'b0}}        ),
+        .i_d            (w_in_valid & w_in_early    ),
+        .o_d            (w_early_buffer             )
+    );
+    //  ラスト
+    lzss_buffer #(
+        .pWidth (1                  ),
+        .pDepth (lpLastBufferSize   ),
+        .pShift (lpLanes            )
     ) u_last_buffer (
-        .clk        (clk                ),
-        .rst_x      (rst_x              ),
-        .i_clear    (w_last_code_done   ),
-        .i_shift    (w_shift            ),
-        .i_d        (i_last             ),
-        .o_d        (w_last_buffer      )
+        .clk            (clk                    ),
+        .rst_x          (rst_x                  ),
+        .i_clear        (1'b0                   ),
+        .i_shift        (w_shift                ),
+        .i_shift_count  ({lpLaneWidth{1'b0}}    ),
+        .i_d            (w_in_last              ),
+        .o_d            (w_last_buffer          )
     );
 
 //----------------------------------------------------------------------
-//  最長一致系列検索
+//  最長一致系列検索(符号化開始位置(レーン)ごと)
 //----------------------------------------------------------------------
-    //  一致比較
     generate
-        for (i = 0;i < pReferenceSize;i = i + 1) begin : matching_loop
-            lzss_enc_match #(
-                .pOffset        (i              ),
-                .pDataWidth     (pDataWidth     ),
-                .pCodingSize    (pCodingSize    ),
+        for (j = 0;j < lpLanes;j = j + 1) begin : lane_loop
+            wire    [lpTotalOffset-1:0]     w_each_offset;
+            wire    [lpTotalLength-1:0]     w_each_length;
+            wire    [pReferenceSize-1:0]    w_each_last;
+            wire    [lpBufferSize-1:0]      w_same_frame;
+
+            //  符号化位置と同じフレームのエントリ
+            for (i = 0;i < lpBufferSize;i = i + 1) begin : same_frame_loop
+                assign  w_same_frame[i] = (w_tag_buffer[i*pFrameTagWidth+:pFrameTagWidth] == w_tag_buffer[(lpCodingIndex+j)*pFrameTagWidth+:pFrameTagWidth]) ? 1'b1 : 1'b0;
+            end
+
+            //  一致比較
+            for (i = 0;i < pReferenceSize;i = i + 1) begin : matching_loop
+                lzss_enc_match #(
+                    .pOffset        (i              ),
+                    .pDataWidth     (pDataWidth     ),
+                    .pCodingSize    (pCodingSize    ),
+                    .pOffsetWidth   (lpOffsetWidth  ),
+                    .pLengthWidth   (lpLengthWidth  )
+                ) u_match (
+                    .clk            (clk                                                            ),
+                    .rst_x          (rst_x                                                          ),
+                    .i_update       (w_shift                                                        ),
+                    .i_clear        (1'b0                                                           ),
+                    .i_valid        (w_valid_buffer[lpCodingIndex+j+:pCodingSize] & w_same_frame[lpCodingIndex+j+:pCodingSize]),
+                    .i_data         (w_data_buffer[(lpCodingIndex+j)*pDataWidth+:lpMatchingData]    ),
+                    .i_last         (w_last_buffer[j+:pCodingSize]                                  ),
+                    .i_ref_valid    (w_valid_buffer[lpHistorySize+j+i+:pCodingSize] & w_same_frame[lpHistorySize+j+i+:pCodingSize]),
+                    .i_ref_data     (w_data_buffer[(lpHistorySize+j+i)*pDataWidth+:lpMatchingData]  ),
+                    .o_offset       (w_each_offset[i*lpOffsetWidth+:lpOffsetWidth]                  ),
+                    .o_length       (w_each_length[i*lpLengthWidth+:lpLengthWidth]                  ),
+                    .o_last         (w_each_last[i]                                                 )
+                );
+            end
+
+            //  検索
+            lzss_enc_search #(
+                .pReferenceSize (pReferenceSize ),
                 .pOffsetWidth   (lpOffsetWidth  ),
-                .pLengthWidth   (lpLengthWidth  )
-            ) u_match (
-                .clk            (clk                                            ),
-                .rst_x          (rst_x                                          ),
-                .i_update       (w_shift                                        ),
-                .i_clear        (w_last_code_done                               ),
-                .i_valid        (w_valid_buffer[lpWindowSize-1-:pCodingSize]    ),
-                .i_data         (w_data_buffer[lpTotalData-1-:lpMatchingData]   ),
-                .i_last         (w_last_buffer[pCodingSize-1:0]                 ),
-                .i_ref_valid    (w_valid_buffer[i+:pCodingSize]                 ),
-                .i_ref_data     (w_data_buffer[i*pDataWidth+:lpMatchingData]    ),
-                .o_offset       (w_each_offset[i*lpOffsetWidth+:lpOffsetWidth]  ),
-                .o_length       (w_each_length[i*lpLengthWidth+:lpLengthWidth]  ),
-                .o_last         (w_each_last[i]                                 )
+                .pLengthWidth   (lpLengthWidth          ),
+                .pRegister      (pSearchRegisterInterval)
+            ) u_search (
+                .clk        (clk                ),
+                .rst_x      (rst_x              ),
+                .i_update   (w_shift            ),
+                .i_clear    (1'b0               ),
+                .i_offset   (w_each_offset      ),
+                .i_length   (w_each_length      ),
+                .i_last     (w_each_last        ),
+                .o_offset   (w_offset[j]        ),
+                .o_length   (w_length[j]        ),
+                .o_last     (w_last[j]          )
             );
         end
     endgenerate
 
-    //  検索
-    lzss_enc_search #(
-        .pReferenceSize (pReferenceSize ),
-        .pOffsetWidth   (lpOffsetWidth  ),
-        .pLengthWidth   (lpLengthWidth  )
-    ) u_search (
-        .clk        (clk                ),
-        .rst_x      (rst_x              ),
-        .i_update   (w_shift            ),
-        .i_clear    (w_last_code_done   ),
-        .i_offset   (w_each_offset      ),
-        .i_length   (w_each_length      ),
-        .i_last     (w_each_last        ),
-        .o_offset   (w_offset           ),
-        .o_length   (w_length           ),
-        .o_last     (w_last             )
-    );
-
 //----------------------------------------------------------------------
 //  エンコード
 //----------------------------------------------------------------------
     assign  o_code  = r_code;
+    assign  o_keep  = r_keep;
     assign  o_last  = r_last;
 
-    assign  w_match         = |w_length;
-    assign  w_out_length    = w_length[lpLengthWidth-2:0] + {(lpLengthWidth-1){1'b1}};
-    assign  w_out_data      = w_data_buffer[lpOutputIndex*pDataWidth+:pDataWidth];
-    assign  w_match_code    = {1'b1, w_offset, w_out_length};
-    assign  w_unmatch_code  = {{(pCodeWidth-pDataWidth){1'b0}}, w_out_data};
-    assign  w_code          = (w_match) ? w_match_code : w_unmatch_code;
+    //  コード開始レーンの判定(前のコードの一致長分のレーンを読み飛ばす)
+    //  早期リテラルは入力時に出力済みのため開始レーンとしない(一致長1として扱う)
+    assign  w_skip[0]   = r_shift_count;
+    assign  w_slot[0]   = {lpLaneWidth{1'b0}};
+    generate
+        for (j = 0;j < lpLanes;j = j + 1) begin : start_loop
+            wire                        w_match;
+            wire    [lpLengthWidth-2:0] w_out_length;
+            wire    [pDataWidth-1:0]    w_out_data;
+
+            assign  w_out_valid[j]  = w_valid_buffer[lpOutputIndex+j];
+            assign  w_start[j]      = (~(|w_skip[j])) & w_out_valid[j] & (~w_early_buffer[lpOutputIndex+j]);
+            assign  w_skip[j+1]     = (w_start[j]  ) ? w_length[j]
+                                    : (|w_skip[j]  ) ? w_skip[j] + {lpLengthWidth{1'b1}}
+                                                     : {lpLengthWidth{1'b0}};
+            assign  w_slot[j+1]     = w_slot[j] + w_start[j];
+
+            assign  w_match         = |w_length[j];
+            assign  w_out_length    = w_length[j][lpLengthWidth-2:0] + {(lpLengthWidth-1){1'b1}};
+            assign  w_out_data      = w_data_buffer[(lpOutputIndex+j)*pDataWidth+:pDataWidth];
+            assign  w_lane_code[j]  = (w_match) ? {1'b1, w_offset[j], w_out_length}
+                                                : {{(pCodeWidth-pDataWidth){1'b0}}, w_out_data};
+        end
+
+        //  早期リテラル(入力データをそのままリテラルコードにする)
+        for (j = 0;j < lpLanes;j = j + 1) begin : early_data_loop
+            assign  w_early_data[j*pCodeWidth+:pCodeWidth]  = {{(pCodeWidth-pDataWidth){1'b0}}, i_data[j*pDataWidth+:pDataWidth]};
+        end
+
+        //  開始レーンのコードを下位から詰める
+        for (i = 0;i < lpLanes;i = i + 1) begin : pack_loop1
+            wire    [lpLanes-1:0]   w_sel;
+
+            assign  w_keep[i]   = |w_sel;
+            for (j = 0;j < lpLanes;j = j + 1) begin : pack_loop2
+                assign  w_sel[j]    = w_start[j] & (w_slot[j] == i);
+            end
+
+            for (j = 0;j < pCodeWidth;j = j + 1) begin : pack_loop3
+                wire    [lpLanes-1:0]   w_code_temp;
+
+                assign  w_code[i*pCodeWidth+j]  = |(w_sel & w_code_temp);
+                for (k = 0;k < lpLanes;k = k + 1) begin : pack_loop4
+                    assign  w_code_temp[k]  = w_lane_code[k][j];
+                end
+            end
+        end
+    endgenerate
 
     always @(posedge clk or negedge rst_x) begin
         if (!rst_x) begin
-            r_code  <= {pCodeWidth{1'b0}};
+            r_code  <= {pOutputWidth{1'b0}};
+            r_keep  <= {lpLanes{1'b0}};
             r_last  <= 1'b0;
         end
-        else if (w_last_code_done) begin
-            r_code  <= {pCodeWidth{1'b0}};
-            r_last  <= 1'b0;
+        else if (w_early_code) begin
+            r_code  <= w_early_data;
+            r_keep  <= w_in_early & i_keep;
+            r_last  <= i_last & (~(|(i_keep & (~w_in_early))));
         end
         else if (w_new_code) begin
             r_code  <= w_code;
-            r_last  <= w_last;
+            r_keep  <= w_keep;
+            r_last  <= |(w_start & w_last);
         end
     end
 
+//----------------------------------------------------------------------
+//  性能カウンタ
+//----------------------------------------------------------------------
+    generate
+        if (pPerfCounter) begin : perf_counter
+            lzss_perf_counter #(
+                .pCodeWidth     (pCodeWidth         ),
+                .pLengthWidth   (lpLengthWidth - 1  ),
+                .pDataLanes     (lpLanes            ),
+                .pCodeLanes     (lpLanes            ),
+                .pHistogramBins (lpHistogramBins    )
+            ) u_perf_counter (
+                .clk            (clk        ),
+                .rst_x          (rst_x      ),
+                .i_data_valid   (i_valid    ),
+                .i_data_ready   (w_ready    ),
+                .i_data_keep    (i_keep     ),
+                .i_code_valid   (r_valid    ),
+                .i_code_ready   (i_ready    ),
+                .i_code         (r_code     ),
+                .i_code_keep    (r_keep     ),
+                .i_psel         (i_psel     ),
+                .i_penable      (i_penable  ),
+                .i_pwrite       (i_pwrite   ),
+                .i_paddr        (i_paddr    ),
+                .i_pwdata       (i_pwdata   ),
+                .o_prdata       (o_prdata   ),
+                .o_pready       (o_pready   )
+            );
+        end
+        else begin : no_perf_counter
+            assign  o_prdata    = 32'h0;
+            assign  o_pready    = 1'b1;
+        end
+    endgenerate
+
 endmodule
@@ -0,0 +1,223 @@
+/**
+ *  @file   lzss_perf_counter.v
+ *  @brief  性能カウンタモジュール
+ *
+ *  データ側(エンコーダの入力/デコーダの出力)とコード側(エンコーダの出力/デコーダの入力)の
+ *  ハンドシェイクを観測し、64bitのカウンタをAPBライクなスレーブ(ウェイトなし)で読み出す。
+ *  アドレスはバイト単位で、各カウンタは下位ワード/上位ワードの順に2ワードを占める。
+ *  下位ワードの読み出し時に上位ワードを保持し、続く上位ワードの読み出しではその値を返す。
+ *
+ *  0x00        : 読み出しは構成({8'h0, ヒストグラムのビン数, コード側レーン数, データ側レーン数})、
+ *                bit0に1を書き込むと全カウンタをクリア
+ *  0x08        : サイクル数
+ *  0x10        : データ数(バイト)
+ *  0x18        : コード数
+ *  0x20        : 一致コード数
+ *  0x28        : リテラルコード数
+ *  0x30        : データ側のストールサイクル数(バリッド & ~レディ)
+ *  0x38        : コード側のストールサイクル数(バリッド & ~レディ)
+ *  0x40 + 8*k  : 一致長k+2の一致コード数(最後のビンはそれ以上の一致長を含む)
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_perf_counter #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pCodeWidth              = 9,                            //!<    コード幅
+    parameter   pLengthWidth            = 2,                            //!<    コードの一致長幅
+    parameter   pDataLanes              = 1,                            //!<    データ側のレーン数
+    parameter   pCodeLanes              = 1,                            //!<    コード側のレーン数
+    parameter   pHistogramBins          = 16,                           //!<    一致長ヒストグラムのビン数(1～24)
+    parameter   pAddressWidth           = 8,                            //!<    アドレス幅
+    parameter   pTotalCode              = pCodeWidth * pCodeLanes       //!<    コードバス幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    //  システム
+    input                               clk,                            //!<    クロック
+    input                               rst_x,                          //!<    非同期リセット
+    //  データ側
+    input                               i_data_valid,                   //!<    データバリッド
+    input                               i_data_ready,                   //!<    データレディ
+    input       [pDataLanes-1:0]        i_data_keep,                    //!<    データ有効レーン
+    //  コード側
+    input                               i_code_valid,                   //!<    コードバリッド
+    input                               i_code_ready,                   //!<    コードレディ
+    input       [pTotalCode-1:0]        i_code,                         //!<    コード
+    input       [pCodeLanes-1:0]        i_code_keep,                    //!<    コード有効レーン
+    //  レジスタアクセス
+    input                               i_psel,                         //!<    セレクト
+    input                               i_penable,                      //!<    イネーブル
+    input                               i_pwrite,                       //!<    ライト
+    input       [pAddressWidth-1:0]     i_paddr,                        //!<    アドレス
+    input       [31:0]                  i_pwdata,                       //!<    ライトデータ
+    output      [31:0]                  o_prdata,                       //!<    リードデータ
+    output                              o_pready                        //!<    レディ
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+name-------------------+value--------------------------+description
+    localparam  lpCycles                = 0;
+    localparam  lpDataCount             = 1;
+    localparam  lpCodeCount             = 2;
+    localparam  lpMatchCount            = 3;
+    localparam  lpLiteralCount          = 4;
+    localparam  lpDataStalls            = 5;
+    localparam  lpCodeStalls            = 6;
+    localparam  lpHistogram             = 7;
+    localparam  lpCounters              = lpHistogram + pHistogramBins;
+    localparam  lpEventWidth            = (pDataLanes > pCodeLanes) ? pDataLanes : pCodeLanes;
+    localparam  lpCountWidth            = log2(lpEventWidth) + 1;
+    localparam  lpIndexWidth            = pAddressWidth - 3;
+    localparam  lpBinWidth              = (pLengthWidth > 0) ? pLengthWidth : 1;
+    localparam  lpConfig                = (pHistogramBins << 16)
+                                        | (pCodeLanes     <<  8)
+                                        |  pDataLanes;
+
+//--type-------+width------------------+name---------------------------+description
+    wire                                w_data_ack;
+    wire                                w_code_ack;
+    wire        [lpEventWidth-1:0]      w_first_lane;
+    wire        [lpEventWidth-1:0]      w_data_event;
+    wire        [lpEventWidth-1:0]      w_match_event;
+    wire        [lpEventWidth-1:0]      w_literal_event;
+    wire        [lpBinWidth-1:0]        w_bin[0:lpEventWidth-1];
+    wire        [lpEventWidth-1:0]      w_event[0:lpCounters-1];
+    wire        [lpCountWidth-1:0]      w_count[0:lpCounters-1];
+    reg         [63:0]                  r_counter[0:lpCounters-1];
+    wire                                w_read;
+    wire                                w_clear;
+    wire        [lpIndexWidth-1:0]      w_index;
+    wire                                w_index_valid;
+    wire        [63:0]                  w_read_counter;
+    reg         [31:0]                  r_read_high;
+    genvar                              i;
+    genvar                              n;
+
+//----------------------------------------------------------------------
+//  イベント
+//----------------------------------------------------------------------
+    assign  w_data_ack  = i_data_valid & i_data_ready;
+    assign  w_code_ack  = i_code_valid & i_code_ready;
+
+    generate
+        for (i = 0;i < lpEventWidth;i = i + 1) begin : lane_loop
+            //  1サイクル1回のイベント用
+            assign  w_first_lane[i] = (i == 0) ? 1'b1 : 1'b0;
+
+            if (i < pDataLanes) begin : data
+                assign  w_data_event[i] = w_data_ack & i_data_keep[i];
+            end
+            else begin : no_data
+                assign  w_data_event[i] = 1'b0;
+            end
+
+            if (i < pCodeLanes) begin : code
+                wire    w_flag;
+
+                //  コードの最上位ビットが一致フラグ
+                assign  w_flag              = i_code[i*pCodeWidth+pCodeWidth-1];
+                assign  w_match_event[i]    = w_code_ack & i_code_keep[i] &   w_flag;
+                assign  w_literal_event[i]  = w_code_ack & i_code_keep[i] & (~w_flag);
+                if (pLengthWidth > 0) begin : length
+                    assign  w_bin[i]    = (i_code[i*pCodeWidth+:pLengthWidth] >= (pHistogramBins - 1)) ? pHistogramBins - 1
+                                                                                                        : i_code[i*pCodeWidth+:pLengthWidth];
+                end
+                else begin : no_length
+                    assign  w_bin[i]    = 1'b0;
+                end
+            end
+            else begin : no_code
+                assign  w_match_event[i]    = 1'b0;
+                assign  w_literal_event[i]  = 1'b0;
+                assign  w_bin[i]            = {lpBinWidth{1'b0}};
+            end
+        end
+    endgenerate
+
+//----------------------------------------------------------------------
+//  カウンタ
+//----------------------------------------------------------------------
+    assign  w_clear = i_psel & i_penable & i_pwrite & (i_paddr[pAddressWidth-1:2] == 0) & i_pwdata[0];
+
+    generate
+        for (n = 0;n < lpCounters;n = n + 1) begin : counter_loop
+            wire    [lpCountWidth-1:0]  w_sum[0:lpEventWidth];
+
+            if (n == lpCycles) begin : cycles
+                assign  w_event[n]  = w_first_lane;
+            end
+            else if (n == lpDataCount) begin : data_count
+                assign  w_event[n]  = w_data_event;
+            end
+            else if (n == lpCodeCount) begin : code_count
+                assign  w_event[n]  = w_match_event | w_literal_event;
+            end
+            else if (n == lpMatchCount) begin : match_count
+                assign  w_event[n]  = w_match_event;
+            end
+            else if (n == lpLiteralCount) begin : literal_count
+                assign  w_event[n]  = w_literal_event;
+            end
+            else if (n == lpDataStalls) begin : data_stalls
+                assign  w_event[n]  = w_first_lane & {lpEventWidth{i_data_valid & (~i_data_ready)}};
+            end
+            else if (n == lpCodeStalls) begin : code_stalls
+                assign  w_event[n]  = w_first_lane & {lpEventWidth{i_code_valid & (~i_code_ready)}};
+            end
+            else begin : histogram
+                for (i = 0;i < lpEventWidth;i = i + 1) begin : bin_loop
+                    assign  w_event[n][i]   = w_match_event[i] & (w_bin[i] == (n - lpHistogram));
+                end
+            end
+
+            //  イベント数
+            assign  w_sum[0]    = {lpCountWidth{1'b0}};
+            for (i = 0;i < lpEventWidth;i = i + 1) begin : sum_loop
+                assign  w_sum[i+1]  = w_sum[i] + w_event[n][i];
+            end
+            assign  w_count[n]  = w_sum[lpEventWidth];
+
+            always @(posedge clk or negedge rst_x) begin
+                if (!rst_x) begin
+                    r_counter[n]    <= 64'h0;
+                end
+                else if (w_clear) begin
+                    r_counter[n]    <= 64'h0;
+                end
+                else begin
+                    r_counter[n]    <= r_counter[n] + w_count[n];
+                end
+            end
+        end
+    endgenerate
+
+//----------------------------------------------------------------------
+//  レジスタアクセス
+//----------------------------------------------------------------------
+    assign  o_pready        = 1'b1;
+
+    assign  w_read          = i_psel & i_penable & (~i_pwrite);
+    assign  w_index         = i_paddr[pAddressWidth-1:3];
+    assign  w_index_valid   = (w_index != 0) && (w_index <= lpCounters);
+    assign  w_read_counter  = (w_index_valid) ? r_counter[w_index-1] : 64'h0;
+    assign  o_prdata        = (~w_read       ) ? 32'h0
+                            : (w_index == 0  ) ? ((i_paddr[2]) ? 32'h0 : lpConfig)
+                            : (i_paddr[2]    ) ? r_read_high
+                                               : w_read_counter[31:0];
+
+    //  下位ワードの読み出しで上位ワードを保持する
+    always @(posedge clk or negedge rst_x) begin
+        if (!rst_x) begin
+            r_read_high <= 32'h0;
+        end
+        else if (w_read && (!i_paddr[2])) begin
+            r_read_high <= w_read_counter[63:32];
+        end
+    end
+
+endmodule
@@ -0,0 +1,56 @@
+/**
+ *  @file   lzss_ram.v
+ *  @brief  シンプルデュアルポートRAMモジュール
+ *
+ *  書き込み1ポート(レーン単位の書き込みイネーブル)、読み出し1ポート(出力レジスタ付き)。
+ *  同じアドレスへの同時アクセスは書き込み前のデータを読み出す。
+ *  ブロックRAMに推論させるため、メモリと出力レジスタにはリセットを付けない。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+module lzss_ram #(
+//--type-------+name-------------------+value--------------------------+description
+    parameter   pWidth                  = 8,                            //!<    データ幅
+    parameter   pDepth                  = 1024,                         //!<    深さ(2以上)
+    parameter   pLaneNum                = 1,                            //!<    書き込みレーン数
+    parameter   pAddressWidth           = log2(pDepth - 1) + 1,         //!<    アドレス幅
+    parameter   pLaneWidth              = pWidth / pLaneNum             //!<    レーン幅
+)(
+//--type-------+width------------------+name---------------------------+description
+    input                               clk,                            //!<    クロック
+    //  書き込み
+    input       [pLaneNum-1:0]          i_we,                           //!<    書き込みイネーブル(レーンごと)
+    input       [pAddressWidth-1:0]     i_waddr,                        //!<    書き込みアドレス
+    input       [pWidth-1:0]            i_wdata,                        //!<    書き込みデータ
+    //  読み出し
+    input                               i_re,                           //!<    読み出しイネーブル
+    input       [pAddressWidth-1:0]     i_raddr,                        //!<    読み出しアドレス
+    output      [pWidth-1:0]            o_rdata                         //!<    読み出しデータ(1サイクル後)
+);
+
+    `include "lzss_function.vh"
+
+//--type-------+width------------------+name---------------------------+description
+    reg         [pWidth-1:0]            r_mem[0:pDepth-1];
+    reg         [pWidth-1:0]            r_rdata;
+    integer                             i;
+
+    assign  o_rdata = r_rdata;
+
+    always @(posedge clk) begin
+        for (i = 0;i < pLaneNum;i = i + 1) begin
+            if (i_we[i]) begin
+                r_mem[i_waddr][i*pLaneWidth+:pLaneWidth]    <= i_wdata[i*pLaneWidth+:pLaneWidth];
+            end
+        end
+        if (i_re) begin
+            r_rdata <= r_mem[i_raddr];
+        end
+    end
+
+endmodule
@@ -20,6 +20,9 @@
 #include "systemc.h"
 #include "lzss_type.h"
 #include "lzss_utility.h"
+#ifdef BURST_SIZE
+#include "lzss_burst_fifo.h"
+#endif
 
 using namespace std;
 using namespace sc_core;
@@ -30,6 +33,14 @@ class Env :
 {
     LzssTypeDefine(reference_size, coding_size)
 
+#ifdef BURST_SIZE
+    typedef LzssBurstFifo<data_packet_t>    data_fifo_t;
+    typedef LzssBurstFifo<code_packet_t>    code_fifo_t;
+#else
+    typedef sc_fifo<data_packet_t>          data_fifo_t;
+    typedef sc_fifo<code_packet_t>          code_fifo_t;
+#endif
+
 public:
     sc_export<data_in_if_t>     enc_data_if;
     sc_export<code_out_if_t>    enc_code_if;
@@ -42,10 +53,10 @@ public:
     virtual void trace(sc_trace_file* tr) const;
 
 protected:
-    sc_fifo<data_packet_t>  enc_data_fifo;
-    sc_fifo<code_packet_t>  enc_code_fifo;
-    sc_fifo<code_packet_t>  dec_code_fifo;
-    sc_fifo<data_packet_t>  dec_data_fifo;
+    data_fifo_t             enc_data_fifo;
+    code_fifo_t             enc_code_fifo;
+    code_fifo_t             dec_code_fifo;
+    data_fifo_t             dec_data_fifo;
 
     Stimulus&               stimulus;
     TimeConstraint&         time_constraint;
@@ -54,14 +65,17 @@ protected:
     sc_event                code_thread_done;
     sc_event                dec_data_thread_done;
 
-    vector<data_t>          enc_data_stream;
-    vector<code_t>          code_stream;
-    vector<data_t>          dec_data_stream;
+    FileWriter<code_t, constants::code_width>   code_writer;
+    FileWriter<data_t, constants::data_width>   dec_data_writer;
 
     data_packet_t           enc_data;
     code_packet_t           code;
     data_packet_t           dec_data;
 
+    vector<data_packet_t>   enc_data_burst;
+    vector<code_packet_t>   code_burst;
+    vector<data_packet_t>   dec_data_burst;
+
     void main_thread();
     void enc_data_thread();
     void code_thread();
@@ -74,10 +88,19 @@ Env<reference_size, coding_size>::Env(const sc_module_name& name, Stimulus& stim
     sc_module       (name),
     stimulus        (stimulus),
     time_constraint (time_constrant),
+#ifdef BURST_SIZE
+    enc_data_fifo   ("enc_data_fifo", BURST_SIZE),
+    enc_code_fifo   ("enc_code_fifo", BURST_SIZE),
+    dec_code_fifo   ("dec_code_fifo", BURST_SIZE),
+    dec_data_fifo   ("dec_data_fifo", BURST_SIZE),
+#else
     enc_data_fifo   (fifo_size),
     enc_code_fifo   (1),
     dec_code_fifo   (fifo_size),
-    dec_data_fifo   (1)
+    dec_data_fifo   (1),
+#endif
+    code_writer     (sc_module::name()),
+    dec_data_writer (sc_module::name())
 {
     SC_THREAD(main_thread);
     SC_THREAD(enc_data_thread);
@@ -127,22 +150,35 @@ void Env<reference_size, coding_size>::watch_dog_thread() {
 
 template <int reference_size, int coding_size>
 void Env<reference_size, coding_size>::enc_data_thread() {
-    Stimulus::iterator                  stimulus_pos    = stimulus.begin();
-    typename vector<data_t>::iterator   data_pos;
-    stringstream                        message;
-    string                              file;
+    Stimulus::iterator      stimulus_pos    = stimulus.begin();
+    StreamSource<data_t>*   source;
+    data_t                  next_data;
+    bool                    next_valid;
+    stringstream            message;
 
     while (stimulus_pos != stimulus.end()) {
-        //  ファイル入力
-        file    = stimulus.data_in_dir + "/" + (*stimulus_pos);
-        read_file<data_t, constants::data_width>(file, enc_data_stream, name());
+        //  入力(ファイル/合成データ)
+        //  ラストの判定のため1データ先読みする
+        source      = create_source<data_t, constants::data_width>(stimulus.data_in_dir, *stimulus_pos, name());
+        next_valid  = source->get(next_data);
         ++stimulus_pos;
 
-        data_pos    = enc_data_stream.begin();
-        while (data_pos != enc_data_stream.end()) {
-            enc_data.value  = *data_pos;
-            ++data_pos;
-            enc_data.last   = (data_pos == enc_data_stream.end()) ? true : false;
+        while (next_valid) {
+#ifdef BURST_SIZE
+            //  バースト単位で入力し、時間もバースト単位で進める
+            enc_data_burst.clear();
+            while (next_valid && (enc_data_burst.size() < BURST_SIZE)) {
+                enc_data.value  = next_data;
+                next_valid      = source->get(next_data);
+                enc_data.last   = !next_valid;
+                enc_data_burst.push_back(enc_data);
+            }
+            enc_data_fifo.write_burst(enc_data_burst);
+            wait(time_constraint.cycle_time * (double)enc_data_burst.size());
+#else
+            enc_data.value  = next_data;
+            next_valid      = source->get(next_data);
+            enc_data.last   = !next_valid;
 
 #ifdef VERBOSE
             message.str("");
@@ -151,7 +187,9 @@ void Env<reference_size, coding_size>::enc_data_thread() {
 #endif
             enc_data_fifo.write(enc_data);
             wait(time_constraint.cycle_time);
+#endif
         }
+        delete source;
     }
     enc_data_thread_done.notify();
 }
@@ -160,24 +198,32 @@ template <int reference_size, int coding_size>
 void Env<reference_size, coding_size>::code_thread() {
     Stimulus::iterator  stimulus_pos    = stimulus.begin();
     stringstream        message;
-    string              file;
 
     while (stimulus_pos != stimulus.end()) {
-        enc_code_fifo.read(code);
-        dec_code_fifo.write(code);
+#ifdef BURST_SIZE
+        enc_code_fifo.read_burst(code_burst);
+        dec_code_fifo.write_burst(code_burst);
+#else
+        code_burst.assign(1, enc_code_fifo.read());
+        dec_code_fifo.write(code_burst[0]);
+#endif
+        for (size_t i = 0;i < code_burst.size();i++) {
+            code    = code_burst[i];
 #ifdef VERBOSE
-        message.str("");
-        message << sc_time_stamp() << "\n" << code;
-        SC_REPORT_INFO(name(), message.str().c_str());
+            message.str("");
+            message << sc_time_stamp() << "\n" << code;
+            SC_REPORT_INFO(name(), message.str().c_str());
 #endif
 
-        code_stream.push_back(code.value);
-        if (code.last) {
             //  ファイル出力
-            file    = stimulus.code_out_dir + "/" + (*stimulus_pos) + ".bin";
-            write_file<code_t, constants::code_width>(file, code_stream, name());
-
-            ++stimulus_pos;
+            if (!code_writer.is_open()) {
+                code_writer.open(stimulus.code_out_dir + "/" + (*stimulus_pos) + ".bin");
+            }
+            code_writer.put(code.value);
+            if (code.last) {
+                code_writer.close();
+                ++stimulus_pos;
+            }
         }
     }
 
@@ -186,34 +232,58 @@ void Env<reference_size, coding_size>::code_thread() {
 
 template <int reference_size, int coding_size>
 void Env<reference_size, coding_size>::dec_data_thread() {
-    Stimulus::iterator  stimulus_pos    = stimulus.begin();
-    stringstream        message;
-    string              file;
-    string              orignal_file;
-    string              diff_command;
-    data_packet_t       data;
+    Stimulus::iterator      stimulus_pos    = stimulus.begin();
+    StreamSource<data_t>*   original        = 0;
+    data_t                  original_data;
+    uint64                  position        = 0;
+    bool                    mismatch        = false;
+    stringstream            message;
 
     while (stimulus_pos != stimulus.end()) {
-        dec_data_fifo.read(dec_data);
+#ifdef BURST_SIZE
+        dec_data_fifo.read_burst(dec_data_burst);
+#else
+        dec_data_burst.assign(1, dec_data_fifo.read());
+#endif
+        for (size_t i = 0;i < dec_data_burst.size();i++) {
+            dec_data    = dec_data_burst[i];
 
 #ifdef VERBOSE
-        message.str("");
-        message << sc_time_stamp() << "\n" << dec_data;
-        SC_REPORT_INFO(name(), message.str().c_str());
+            message.str("");
+            message << sc_time_stamp() << "\n" << dec_data;
+            SC_REPORT_INFO(name(), message.str().c_str());
 #endif
 
-        dec_data_stream.push_back(dec_data.value);
-        if (dec_data.last) {
             //  ファイル出力
-            file    = stimulus.data_out_dir + "/" + (*stimulus_pos);
-            write_file<data_t, constants::data_width>(file, dec_data_stream, name());
-
-            //  一致比較
-            orignal_file    = stimulus.data_in_dir  + "/" + (*stimulus_pos);
-            diff_command    = string("diff ") + orignal_file + " " + file;
-            system(diff_command.c_str());
-
-            ++stimulus_pos;
+            if (original == 0) {
+                dec_data_writer.open(stimulus.data_out_dir + "/" + (*stimulus_pos));
+                original    = create_source<data_t, constants::data_width>(stimulus.data_in_dir, *stimulus_pos, name());
+                position    = 0;
+                mismatch    = false;
+            }
+            dec_data_writer.put(dec_data.value);
+
+            //  入力データとの逐次比較
+            if ((!mismatch) && ((!original->get(original_data)) || (original_data != dec_data.value))) {
+                mismatch    = true;
+                message.str("");
+                message << sc_time_stamp() << "\nMismatch : " << (*stimulus_pos) << " (byte " << position << ")";
+                SC_REPORT_ERROR(name(), message.str().c_str());
+            }
+            position    += 1;
+
+            if (dec_data.last) {
+                dec_data_writer.close();
+                if ((!mismatch) && original->get(original_data)) {
+                    message.str("");
+                    message << sc_time_stamp() << "\nMismatch : " << (*stimulus_pos) << " (too short : " << position << " bytes)";
+                    SC_REPORT_ERROR(name(), message.str().c_str());
+                }
+                delete original;
+                original    = 0;
+
+                ++stimulus_pos;
+            }
         }
     }
 
@@ -0,0 +1,184 @@
+/**
+ *  @file   lzss_burst_fifo.h
+ *  @brief  バースト単位で転送するLzssPacket用FIFO
+ *
+ *  sc_fifoと同じインターフェースを持つが、書き込んだパケットは
+ *  バーストサイズに達するかラストが書き込まれるまで読み出し側に見えない。
+ *  イベントの通知はバースト単位となる。
+ *  Envからはread_burst/write_burstでバースト単位の読み書きもできる。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_BURST_FIFO_H_
+#define LZSS_BURST_FIFO_H_
+
+#include <vector>
+#include <deque>
+#include "systemc.h"
+
+using namespace std;
+using namespace sc_core;
+
+template <typename T>
+class LzssBurstFifo :
+    public  sc_prim_channel,
+    public  sc_fifo_in_if<T>,
+    public  sc_fifo_out_if<T>
+{
+public:
+    LzssBurstFifo(const char* name, int burst_size, int depth = 2);
+
+    void read(T& value);
+    T read();
+    bool nb_read(T& value);
+    int num_available() const;
+    const sc_event& data_written_event() const;
+
+    void write(const T& value);
+    bool nb_write(const T& value);
+    int num_free() const;
+    const sc_event& data_read_event() const;
+
+    void read_burst(vector<T>& burst);
+    void write_burst(const vector<T>& burst);
+
+protected:
+    const size_t        burst_size;
+    const size_t        depth;
+
+    deque<vector<T> >   bursts;
+    vector<T>           write_buffer;
+    vector<T>           read_buffer;
+    size_t              read_position;
+    size_t              available;
+
+    sc_event            written_event;
+    sc_event            read_event;
+
+    bool commit_needed(const T& value) const {
+        return ((write_buffer.size() + 1) >= burst_size) || value.last;
+    }
+    void commit();
+    bool next_burst();
+};
+
+template <typename T>
+LzssBurstFifo<T>::LzssBurstFifo(const char* name, int burst_size, int depth) :
+    sc_prim_channel (name),
+    burst_size      (burst_size),
+    depth           (depth),
+    read_position   (0),
+    available       (0)
+{
+    write_buffer.reserve(burst_size);
+}
+
+template <typename T>
+void LzssBurstFifo<T>::read(T& value) {
+    while (!nb_read(value)) {
+        wait(written_event);
+    }
+}
+
+template <typename T>
+T LzssBurstFifo<T>::read() {
+    T   value;
+    read(value);
+    return value;
+}
+
+template <typename T>
+bool LzssBurstFifo<T>::nb_read(T& value) {
+    if ((read_position == read_buffer.size()) && (!next_burst())) {
+        return false;
+    }
+    value   = read_buffer[read_position++];
+    available   -= 1;
+    return true;
+}
+
+template <typename T>
+int LzssBurstFifo<T>::num_available() const {
+    return available;
+}
+
+template <typename T>
+const sc_event& LzssBurstFifo<T>::data_written_event() const {
+    return written_event;
+}
+
+template <typename T>
+void LzssBurstFifo<T>::write(const T& value) {
+    while (!nb_write(value)) {
+        wait(read_event);
+    }
+}
+
+template <typename T>
+bool LzssBurstFifo<T>::nb_write(const T& value) {
+    if (commit_needed(value) && (bursts.size() >= depth)) {
+        return false;
+    }
+    write_buffer.push_back(value);
+    if (commit_needed(value)) {
+        commit();
+    }
+    return true;
+}
+
+template <typename T>
+int LzssBurstFifo<T>::num_free() const {
+    //  書き込み中のバーストの残り(確定できない場合は確定が必要になる直前まで)
+    return burst_size - write_buffer.size() - ((bursts.size() >= depth) ? 1 : 0);
+}
+
+template <typename T>
+const sc_event& LzssBurstFifo<T>::data_read_event() const {
+    return read_event;
+}
+
+template <typename T>
+void LzssBurstFifo<T>::read_burst(vector<T>& burst) {
+    while ((read_position == read_buffer.size()) && (!next_burst())) {
+        wait(written_event);
+    }
+    burst.assign(read_buffer.begin() + read_position, read_buffer.end());
+    available       -= burst.size();
+    read_position   = read_buffer.size();
+}
+
+template <typename T>
+void LzssBurstFifo<T>::write_burst(const vector<T>& burst) {
+    for (size_t i = 0;i < burst.size();i++) {
+        write(burst[i]);
+    }
+}
+
+template <typename T>
+void LzssBurstFifo<T>::commit() {
+    available   += write_buffer.size();
+    bursts.push_back(vector<T>());
+    bursts.back().swap(write_buffer);
+    write_buffer.reserve(burst_size);
+    written_event.notify(SC_ZERO_TIME);
+}
+
+template <typename T>
+bool LzssBurstFifo<T>::next_burst() {
+    if (bursts.empty()) {
+        return false;
+    }
+    read_buffer.swap(bursts.front());
+    bursts.pop_front();
+    read_position   = 0;
+    read_event.notify(SC_ZERO_TIME);
+    return true;
+}
+
+#endif /* LZSS_BURST_FIFO_H_ */
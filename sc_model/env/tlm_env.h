@@ -0,0 +1,223 @@
+/**
+ *  @file   tlm_env.h
+ *  @brief  TLMラッパ用の環境
+ *
+ *  ファイル単位でLzssEncTlmにエンコードさせ、その結果をLzssDecTlmでデコードして
+ *  元ファイルと比較する。バッファアクセスは可能な場合DMIを使用し、
+ *  時間はtlm_quantumkeeperで管理する。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef TLM_ENV_H_
+#define TLM_ENV_H_
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <stdint.h>
+#include "systemc.h"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include "lzss_type.h"
+#include "lzss_utility.h"
+#include "lzss_tlm.h"
+
+using namespace std;
+using namespace sc_core;
+
+template <int reference_size = 32, int coding_size = 9>
+class TlmEnv :
+    public  sc_module
+{
+    LzssTypeDefine(reference_size, coding_size)
+
+    typedef tlm_utils::simple_initiator_socket<TlmEnv>  socket_t;
+
+    //  ターゲットごとのDMI領域
+    struct DmiCache {
+        vector<tlm::tlm_dmi>    regions;
+
+        unsigned char* find(uint64 address, unsigned int size, bool write) {
+            for (size_t i = 0;i < regions.size();i++) {
+                tlm::tlm_dmi&   dmi = regions[i];
+                if ((address >= dmi.get_start_address()) && ((address + size - 1) <= dmi.get_end_address()) &&
+                    ((write) ? dmi.is_write_allowed() : dmi.is_read_allowed())) {
+                    return dmi.get_dmi_ptr() + (address - dmi.get_start_address());
+                }
+            }
+            return 0;
+        }
+    };
+
+public:
+    socket_t    enc_socket;
+    socket_t    dec_socket;
+
+    typedef TlmEnv<reference_size, coding_size> SC_CURRENT_USER_MODULE;
+    TlmEnv(const sc_module_name& name, Stimulus& stimulus, TimeConstraint& time_constrant, int quantum_cycles = 1000);
+
+    virtual void trace(sc_trace_file* tr) const {}
+
+protected:
+    Stimulus&                       stimulus;
+    TimeConstraint&                 time_constraint;
+
+    tlm_utils::tlm_quantumkeeper    quantum_keeper;
+    DmiCache                        enc_dmi;
+    DmiCache                        dec_dmi;
+
+    vector<data_t>                  data_stream;
+    vector<unsigned char>           buffer;
+
+    void main_thread();
+    void invalidate_direct_mem_ptr(uint64 start, uint64 end);
+
+    void run(socket_t& socket, DmiCache& dmi_cache, vector<unsigned char>& data, uint32_t& size);
+    void transport(socket_t& socket, DmiCache& dmi_cache, tlm::tlm_command command, uint64 address, unsigned char* data, unsigned int size);
+};
+
+template <int reference_size, int coding_size>
+TlmEnv<reference_size, coding_size>::TlmEnv(const sc_module_name& name, Stimulus& stimulus, TimeConstraint& time_constrant, int quantum_cycles) :
+    sc_module       (name),
+    enc_socket      ("enc_socket"),
+    dec_socket      ("dec_socket"),
+    stimulus        (stimulus),
+    time_constraint (time_constrant)
+{
+    SC_THREAD(main_thread);
+
+    enc_socket.register_invalidate_direct_mem_ptr(this, &TlmEnv::invalidate_direct_mem_ptr);
+    dec_socket.register_invalidate_direct_mem_ptr(this, &TlmEnv::invalidate_direct_mem_ptr);
+
+    tlm_utils::tlm_quantumkeeper::set_global_quantum(time_constraint.cycle_time * quantum_cycles);
+    quantum_keeper.reset();
+}
+
+template <int reference_size, int coding_size>
+void TlmEnv<reference_size, coding_size>::main_thread() {
+    Stimulus::iterator  stimulus_pos    = stimulus.begin();
+    stringstream        message;
+    string              file;
+    string              diff_command;
+    uint32_t            size;
+
+    message << sc_time_stamp() << "\nSimulation started";
+    SC_REPORT_INFO(name(), message.str().c_str());
+
+    while (stimulus_pos != stimulus.end()) {
+        //  ファイル入力
+        file    = stimulus.data_in_dir + "/" + (*stimulus_pos);
+        read_file<data_t, constants::data_width>(file, data_stream, name());
+        buffer.resize(data_stream.size() + 1);
+        size    = pack_stream<data_t, constants::data_width>(data_stream, &buffer[0]);
+
+        //  エンコード
+        run(enc_socket, enc_dmi, buffer, size);
+        unpack_stream<data_t, constants::data_width>(&buffer[0], size, data_stream);
+        file    = stimulus.code_out_dir + "/" + (*stimulus_pos) + ".bin";
+        write_file<data_t, constants::data_width>(file, data_stream, name());
+
+        //  デコード
+        run(dec_socket, dec_dmi, buffer, size);
+        unpack_stream<data_t, constants::data_width>(&buffer[0], size, data_stream);
+        file    = stimulus.data_out_dir + "/" + (*stimulus_pos);
+        write_file<data_t, constants::data_width>(file, data_stream, name());
+
+        //  一致比較
+        diff_command    = string("diff ") + stimulus.data_in_dir + "/" + (*stimulus_pos) + " " + file;
+        if (system(diff_command.c_str()) != 0) {
+            message.str("");
+            message << sc_time_stamp() << "\nMismatch : " << (*stimulus_pos);
+            SC_REPORT_ERROR(name(), message.str().c_str());
+        }
+
+        ++stimulus_pos;
+    }
+    quantum_keeper.sync();
+
+    message.str("");
+    message << sc_time_stamp() << "\nSimulation finished";
+    SC_REPORT_INFO(name(), message.str().c_str());
+    sc_stop();
+}
+
+template <int reference_size, int coding_size>
+void TlmEnv<reference_size, coding_size>::invalidate_direct_mem_ptr(uint64 start, uint64 end) {
+    enc_dmi.regions.clear();
+    dec_dmi.regions.clear();
+}
+
+/**
+ *  入力バッファへの書き込み、処理開始、出力バッファの読み出しを行う
+ *  dataは出力データで上書きされる
+ */
+template <int reference_size, int coding_size>
+void TlmEnv<reference_size, coding_size>::run(socket_t& socket, DmiCache& dmi_cache, vector<unsigned char>& data, uint32_t& size) {
+    transport(socket, dmi_cache, tlm::TLM_WRITE_COMMAND, LzssTlmAddress::input_buffer, &data[0], size);
+    transport(socket, dmi_cache, tlm::TLM_WRITE_COMMAND, LzssTlmAddress::input_size, (unsigned char*)&size, sizeof(size));
+    transport(socket, dmi_cache, tlm::TLM_READ_COMMAND , LzssTlmAddress::output_size, (unsigned char*)&size, sizeof(size));
+    data.resize(size + 1);
+    transport(socket, dmi_cache, tlm::TLM_READ_COMMAND , LzssTlmAddress::output_buffer, &data[0], size);
+}
+
+template <int reference_size, int coding_size>
+void TlmEnv<reference_size, coding_size>::transport(socket_t& socket, DmiCache& dmi_cache, tlm::tlm_command command, uint64 address, unsigned char* data, unsigned int size) {
+    tlm::tlm_generic_payload    trans;
+    tlm::tlm_dmi                dmi;
+    sc_time                     delay;
+    unsigned char*              pointer;
+    stringstream                message;
+
+    if (size == 0) {
+        return;
+    }
+
+    //  DMI
+    pointer = dmi_cache.find(address, size, command == tlm::TLM_WRITE_COMMAND);
+    if (pointer != 0) {
+        if (command == tlm::TLM_WRITE_COMMAND) {
+            memcpy(pointer, data, size);
+        }
+        else {
+            memcpy(data, pointer, size);
+        }
+        return;
+    }
+
+    trans.set_command(command);
+    trans.set_address(address);
+    trans.set_data_ptr(data);
+    trans.set_data_length(size);
+    trans.set_streaming_width(size);
+    trans.set_byte_enable_ptr(0);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+    delay   = quantum_keeper.get_local_time();
+    socket->b_transport(trans, delay);
+    quantum_keeper.set(delay);
+    if (quantum_keeper.need_sync()) {
+        quantum_keeper.sync();
+    }
+
+    if (trans.is_response_error()) {
+        message << sc_time_stamp() << "\nTransaction error : 0x" << hex << address;
+        SC_REPORT_FATAL(name(), message.str().c_str());
+        return;
+    }
+
+    if (trans.is_dmi_allowed() && socket->get_direct_mem_ptr(trans, dmi)) {
+        dmi_cache.regions.push_back(dmi);
+    }
+}
+
+#endif /* TLM_ENV_H_ */
@@ -16,9 +16,14 @@
 #include "systemc.h"
 #include "lzss_type.h"
 #include "lzss_utility.h"
+#ifdef TLM_MODEL
+#include "tlm_env.h"
+#include "lzss_tlm.h"
+#else
 #include "env.h"
 #include "lzss_enc.h"
 #include "lzss_dec.h"
+#endif
 
 using namespace std;
 using namespace sc_core;
@@ -28,12 +33,18 @@ template <int reference_size = 32, int coding_size = 9>
 class Top :
     public  sc_module
 {
+#ifdef TLM_MODEL
+    typedef TlmEnv<reference_size, coding_size>     env_t;
+    typedef LzssEncTlm<reference_size, coding_size> enc_t;
+    typedef LzssDecTlm<reference_size, coding_size> dec_t;
+#else
     typedef Env<reference_size, coding_size>        env_t;
     typedef LzssEnc<reference_size, coding_size>    enc_t;
     typedef LzssDec<reference_size, coding_size>    dec_t;
+#endif
 
 public:
-    Top(const sc_module_name& name, double cycle_time, double time_out, sc_time_unit unit);
+    Top(const sc_module_name& name, double cycle_time, double time_out, sc_time_unit unit, bool length_extension = false);
     virtual ~Top();
 
 protected:
@@ -52,7 +63,7 @@ protected:
 };
 
 template <int reference_size, int coding_size>
-Top<reference_size, coding_size>::Top(const sc_module_name& name, double cycle_time, double time_out, sc_time_unit unit) :
+Top<reference_size, coding_size>::Top(const sc_module_name& name, double cycle_time, double time_out, sc_time_unit unit, bool length_extension) :
     time_constraint (cycle_time, time_out, unit),
     tr              (0)
 {
@@ -60,16 +71,30 @@ Top<reference_size, coding_size>::Top(const sc_module_name& name, double cycle_t
     stimulus.code_out_dir   = "./encode";
     stimulus.data_out_dir   = "./decode";
     stimulus.dump_dir       = "./dump";
-    set_stimulus();
+    if (!stimulus.parse_arguments(sc_argc(), sc_argv())) {
+        SC_REPORT_FATAL("top", "Usage : [-i input_dir] [-l list_file] [-s index/count] [stimulus ...]");
+    }
+    if (stimulus.list_size() == 0) {
+        set_stimulus();
+    }
+    stimulus.apply_shard();
 
     env = new env_t("env", stimulus, time_constraint);
-    enc = new enc_t("enc");
-    dec = new dec_t("dec");
+#ifdef TLM_MODEL
+    enc = new enc_t("enc", length_extension, time_constraint.cycle_time);
+    dec = new dec_t("dec", length_extension, time_constraint.cycle_time);
+
+    env->enc_socket.bind(enc->socket);
+    env->dec_socket.bind(dec->socket);
+#else
+    enc = new enc_t("enc", length_extension);
+    dec = new dec_t("dec", length_extension);
 
     enc->data_in_if(env->enc_data_if);
     enc->code_out_if(env->enc_code_if);
     dec->code_in_if(env->dec_code_if);
     dec->data_out_if(env->dec_data_if);
+#endif
 };
 
 template <int reference_size, int coding_size>
@@ -121,6 +146,10 @@ void Top<reference_size, coding_size>::set_stimulus() {
     stimulus.add_file("test1.txt");
     stimulus.add_file("test2.txt");
 #endif
+#ifdef SYNTHETIC_SIZE
+    //  長時間試験用の合成データ
+    stimulus.add_synthetic(SYNTHETIC_SIZE, 1);
+#endif
 }
 #endif
 
@@ -0,0 +1,117 @@
+/**
+ *  @file   lzss_stimulus.h
+ *  @brief  スティミュラスのリストと実行時引数の解析(SystemCを使用しない共通部分)
+ *
+ *  sc_model/etc/lzss_utility.hのStimulusとsim/cpp/cpp_stimulus.hのCppStimulusの基底。
+ *      -i <dir>            入力ディレクトリ
+ *      -l <file>           スティミュラスリスト(1行1件, #以降はコメント)
+ *      -s <index>/<count>  リストをcount個に分割したindex番目(0 -)のみ実行する
+ *      <name> ...          スティミュラス
+ *  これ以外にflag_optionsで指定した1文字の引数なしオプションを受け付ける。
+ *  シャード分割(apply_shard)は既定のリストを追加した後に呼び出し側で行う。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_STIMULUS_H_
+#define LZSS_STIMULUS_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+
+using namespace std;
+
+struct StimulusList {
+    vector<string>  list;
+    string          data_in_dir;
+    string          flags;
+    int             shard_index;
+    int             shard_count;
+
+    StimulusList() :
+        shard_index (0),
+        shard_count (1)
+    {}
+
+    /**
+     *  実行時引数からスティミュラスを設定する
+     *  @return 引数が不正な場合false
+     */
+    bool parse_arguments(int argc, const char* const* argv, const string& flag_options = "") {
+        char    separator;
+
+        for (int i = 1;i < argc;i++) {
+            const string    option  = argv[i];
+            if ((option == "-i") && ((i + 1) < argc)) {
+                data_in_dir = argv[++i];
+            }
+            else if ((option == "-l") && ((i + 1) < argc)) {
+                if (!add_list(argv[++i])) {
+                    return false;
+                }
+            }
+            else if ((option == "-s") && ((i + 1) < argc)) {
+                if ((sscanf(argv[++i], "%d%c%d", &shard_index, &separator, &shard_count) != 3) ||
+                    (separator != '/') || (shard_count < 1) || (shard_index < 0) || (shard_index >= shard_count)) {
+                    return false;
+                }
+            }
+            else if ((option.size() == 2) && (option[0] == '-') && (flag_options.find(option[1]) != string::npos)) {
+                flags  += option[1];
+            }
+            else if ((!option.empty()) && (option[0] == '-')) {
+                return false;
+            }
+            else {
+                list.push_back(option);
+            }
+        }
+        return true;
+    }
+
+    bool add_list(const char* file) {
+        ifstream    ifs(file);
+        string      line;
+        size_t      position;
+
+        if (!ifs.good()) {
+            return false;
+        }
+        while (getline(ifs, line)) {
+            position    = line.find('#');
+            if (position != string::npos) {
+                line.erase(position);
+            }
+            position    = line.find_last_not_of(" \t\r");
+            if (position == string::npos) {
+                continue;
+            }
+            line.erase(position + 1);
+            line.erase(0, line.find_first_not_of(" \t"));
+            list.push_back(line);
+        }
+        return true;
+    }
+
+    //  シャード分割(リストのindex番目からcount個おきに残す)
+    void apply_shard() {
+        vector<string>  shard;
+        for (size_t i = shard_index;i < list.size();i += shard_count) {
+            shard.push_back(list[i]);
+        }
+        list.swap(shard);
+    }
+
+    bool has_flag(char flag) const {
+        return flags.find(flag) != string::npos;
+    }
+};
+
+#endif /* LZSS_STIMULUS_H_ */
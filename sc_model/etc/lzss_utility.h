@@ -14,10 +14,13 @@
 #define LZSS_UTILITY_H_
 
 #include <iostream>
+#include <fstream>
 #include <sstream>
 #include <vector>
 #include <string>
+#include <cstdio>
 #include "systemc.h"
+#include "lzss_stimulus.h"
 
 using namespace std;
 using namespace sc_core;
@@ -37,66 +40,356 @@ struct Log2<1> {
     };
 };
 
+/**
+ *  入力データ列の読み出し元
+ *  ファイル/合成データを区別せずに1データずつ取り出す。
+ */
+template <typename T>
+class StreamSource {
+public:
+    virtual ~StreamSource() {}
+
+    /**
+     *  @return データを取り出せた場合true(終端ではfalse)
+     */
+    virtual bool get(T& value) = 0;
+};
+
+/**
+ *  ビット幅Wで上位ビットから詰めたファイルをチャンク単位で読み出す
+ */
 template <typename T, int W>
-void read_file(string& file, vector<T>& stream, const char* id) {
-    ifstream        ifs(file.c_str(), ios::in | ios::binary);
-    stringstream    message;
+class FileReader :
+    public  StreamSource<T>
+{
+public:
+    FileReader(const string& file, const char* id, size_t chunk_size = 65536);
+
+    bool good() const {
+        return opened;
+    }
+
+    bool get(T& value);
+
+protected:
+    ifstream        ifs;
+    const string    file;
+    const string    id;
+    bool            opened;
+    bool            done;
+    vector<char>    chunk;
+    size_t          chunk_pos;
+    size_t          chunk_bytes;
     char            byte;
-    unsigned int    data;
     int             byte_pos;
+    unsigned int    data;
     int             data_pos;
     unsigned int    byte_count;
 
-    if (!ifs.good()) {
+    bool next_byte();
+};
+
+template <typename T, int W>
+FileReader<T, W>::FileReader(const string& file, const char* id, size_t chunk_size) :
+    ifs         (file.c_str(), ios::in | ios::binary),
+    file        (file),
+    id          (id),
+    opened      (ifs.good()),
+    done        (false),
+    chunk       (chunk_size),
+    chunk_pos   (0),
+    chunk_bytes (0),
+    byte        (0),
+    byte_pos    (0),
+    data        (0),
+    data_pos    (W),
+    byte_count  (0)
+{
+    stringstream    message;
+
+    if (!opened) {
+        done    = true;
         message << sc_time_stamp() << "\nCould not be opened : " << file;
         SC_REPORT_FATAL(id, message.str().c_str());
-        return;
     }
+}
 
-    data        = 0;
-    data_pos    = W;
-    byte_count  = 0;
-    stream.clear();
+template <typename T, int W>
+bool FileReader<T, W>::get(T& value) {
     while (true) {
-        ifs.get(byte);
-        if (ifs.eof()) {
-            break;
+        if ((byte_pos == 0) && (!next_byte())) {
+            return false;
         }
 
-        byte_count  += 1;
-        for (byte_pos = 8;byte_pos > 0;byte_pos--) {
-            data    |= (byte >> (byte_pos - 1) & 0x1) << (data_pos - 1);
-            if (data_pos == 1) {
-                stream.push_back((T)data);
-                data        = 0;
-                data_pos    = W;
-            }
-            else {
-                data_pos    -= 1;
-            }
+        data    |= (byte >> (byte_pos - 1) & 0x1) << (data_pos - 1);
+        byte_pos    -= 1;
+        if (data_pos == 1) {
+            value       = (T)data;
+            data        = 0;
+            data_pos    = W;
+            return true;
+        }
+        else {
+            data_pos    -= 1;
         }
     }
-    ifs.close();
-
-    message << sc_time_stamp() << "\nRead : " << file << " (" << byte_count << " bytes)";
-    SC_REPORT_INFO(id, message.str().c_str());
 }
 
 template <typename T, int W>
-void write_file(string& file, vector<T>& stream, const char* id) {
-    ofstream        ofs(file.c_str(), ios::out | ios::binary);
+bool FileReader<T, W>::next_byte() {
     stringstream    message;
+
+    if (done) {
+        return false;
+    }
+
+    if (chunk_pos == chunk_bytes) {
+        ifs.read(&chunk[0], chunk.size());
+        chunk_bytes = ifs.gcount();
+        chunk_pos   = 0;
+        if (chunk_bytes == 0) {
+            done    = true;
+            ifs.close();
+
+            message << sc_time_stamp() << "\nRead : " << file << " (" << byte_count << " bytes)";
+            SC_REPORT_INFO(id.c_str(), message.str().c_str());
+            return false;
+        }
+    }
+
+    byte        = chunk[chunk_pos++];
+    byte_pos    = 8;
+    byte_count  += 1;
+    return true;
+}
+
+/**
+ *  合成データの生成
+ *  ランダムなバイトと直前256byte内のコピーを混ぜた圧縮可能なデータ列を生成する。
+ *  同じシードからは同じデータ列が生成される。
+ */
+template <typename T>
+class SyntheticSource :
+    public  StreamSource<T>
+{
+public:
+    SyntheticSource(uint64 size, unsigned int seed) :
+        size        (size),
+        count       (0),
+        state       (seed),
+        distance    (0),
+        remain      (0),
+        history     (256, 0)
+    {}
+
+    bool get(T& value) {
+        unsigned int    random;
+        unsigned char   byte;
+
+        if (count == size) {
+            return false;
+        }
+
+        //  1/4の確率で過去データのコピー(2 - 33byte)、それ以外はランダムな1byte
+        if (remain == 0) {
+            random      = next_random();
+            distance    = 1 + ((random >> 2) % 255);
+            remain      = 2 + ((random >> 10) % 32);
+            if (((random & 0x3) != 0) || (distance > count)) {
+                distance    = 0;
+                remain      = 1;
+            }
+        }
+
+        if (distance != 0) {
+            byte    = history[(count - distance) & 0xff];
+        }
+        else {
+            byte    = " etaoinshrdlucmfwypvbgkjqxz\n.,ETAOINSHRDLU0123456789"[next_random() % 52];
+        }
+        history[count & 0xff]   = byte;
+        count   += 1;
+        remain  -= 1;
+
+        value   = (T)byte;
+        return true;
+    }
+
+protected:
+    const uint64            size;
+    uint64                  count;
+    unsigned int            state;
+    unsigned int            distance;
+    unsigned int            remain;
+    vector<unsigned char>   history;
+
+    unsigned int next_random() {
+        state   = state * 1103515245 + 12345;
+        return (state >> 16) & 0x7fff;
+    }
+};
+
+/**
+ *  ビット幅Wで上位ビットから詰めてファイルにチャンク単位で書き込む
+ */
+template <typename T, int W>
+class FileWriter {
+public:
+    FileWriter(const char* id, size_t chunk_size = 65536) :
+        id          (id),
+        chunk_size  (chunk_size),
+        opened      (false)
+    {}
+
+    ~FileWriter() {
+        close();
+    }
+
+    bool is_open() const {
+        return opened;
+    }
+
+    bool open(const string& file);
+    void put(const T& value);
+    void close();
+
+protected:
+    ofstream        ofs;
+    string          file;
+    const string    id;
+    const size_t    chunk_size;
+    bool            opened;
+    vector<char>    chunk;
     char            byte;
-    unsigned int    data;
     int             byte_pos;
-    int             data_pos;
     unsigned int    byte_count;
 
+    void flush();
+};
+
+template <typename T, int W>
+bool FileWriter<T, W>::open(const string& file) {
+    stringstream    message;
+
+    close();
+    this->file  = file;
+    ofs.open(file.c_str(), ios::out | ios::binary);
     if (!ofs.good()) {
         message << sc_time_stamp() << "\nCould not be opened : " << file;
-        SC_REPORT_FATAL(id, message.str().c_str());
+        SC_REPORT_FATAL(id.c_str(), message.str().c_str());
+        return false;
+    }
+
+    opened      = true;
+    byte        = 0;
+    byte_pos    = 8;
+    byte_count  = 0;
+    chunk.clear();
+    chunk.reserve(chunk_size);
+    return true;
+}
+
+template <typename T, int W>
+void FileWriter<T, W>::put(const T& value) {
+    unsigned int    data    = (unsigned int)value;
+    int             data_pos;
+
+    for (data_pos = W;data_pos > 0;data_pos--) {
+        byte    |= ((data >> (data_pos - 1)) & 0x1) << (byte_pos - 1);
+        if (byte_pos == 1) {
+            chunk.push_back(byte);
+            byte        = 0;
+            byte_pos    = 8;
+            byte_count  += 1;
+            if (chunk.size() == chunk_size) {
+                flush();
+            }
+        }
+        else {
+            byte_pos    -= 1;
+        }
+    }
+}
+
+template <typename T, int W>
+void FileWriter<T, W>::close() {
+    stringstream    message;
+
+    if (!opened) {
+        return;
+    }
+
+    if (byte_pos != 8) {
+        chunk.push_back(byte);
+        byte_count  += 1;
+    }
+    flush();
+    ofs.close();
+    opened  = false;
+
+    message << sc_time_stamp() << "\nWrite : " << file << " (" << byte_count << " bytes)";
+    SC_REPORT_INFO(id.c_str(), message.str().c_str());
+}
+
+template <typename T, int W>
+void FileWriter<T, W>::flush() {
+    if (!chunk.empty()) {
+        ofs.write(&chunk[0], chunk.size());
+        chunk.clear();
+    }
+}
+
+/**
+ *  入力データ列の読み出し元を生成する
+ *  名前が"synthetic:<サイズ>:<シード>"の場合は合成データ、それ以外はdir/nameのファイル
+ */
+template <typename T, int W>
+StreamSource<T>* create_source(const string& dir, const string& name, const char* id) {
+    unsigned long long  size;
+    unsigned int        seed;
+
+    if (sscanf(name.c_str(), "synthetic:%llu:%u", &size, &seed) == 2) {
+        return new SyntheticSource<T>(size, seed);
+    }
+    return new FileReader<T, W>(dir + "/" + name, id);
+}
+
+template <typename T, int W>
+void read_file(string& file, vector<T>& stream, const char* id) {
+    FileReader<T, W>    reader(file, id);
+    T                   value;
+
+    stream.clear();
+    while (reader.get(value)) {
+        stream.push_back(value);
+    }
+}
+
+template <typename T, int W>
+void write_file(string& file, vector<T>& stream, const char* id) {
+    FileWriter<T, W>    writer(id);
+
+    if (!writer.open(file)) {
         return;
     }
+    for (size_t i = 0;i < stream.size();i++) {
+        writer.put(stream[i]);
+    }
+    writer.close();
+    stream.clear();
+}
+
+/**
+ *  ビット幅Wのデータ列を上位ビットから詰めてバイト列に変換する(write_fileと同じ形式)
+ *  @return 変換後のバイト数
+ */
+template <typename T, int W>
+size_t pack_stream(const vector<T>& stream, unsigned char* bytes) {
+    unsigned char   byte;
+    unsigned int    data;
+    int             byte_pos;
+    int             data_pos;
+    size_t          byte_count;
 
     byte        = 0;
     byte_pos    = 8;
@@ -107,10 +400,9 @@ void write_file(string& file, vector<T>& stream, const char* id) {
         for (data_pos = W;data_pos > 0;data_pos--) {
             byte    |= ((data >> (data_pos - 1)) & 0x1) << (byte_pos - 1);
             if (byte_pos == 1) {
-                ofs.put(byte);
+                bytes[byte_count++] = byte;
                 byte        = 0;
                 byte_pos    = 8;
-                byte_count  += 1;
             }
             else {
                 byte_pos    -= 1;
@@ -118,19 +410,44 @@ void write_file(string& file, vector<T>& stream, const char* id) {
         }
     }
     if (byte_pos != 8) {
-        ofs.put(byte);
-        byte_count  += 1;
+        bytes[byte_count++] = byte;
     }
-    ofs.close();
-    stream.clear();
 
-    message << sc_time_stamp() << "\nWrite : " << file << " (" << byte_count << " bytes)";
-    SC_REPORT_INFO(id, message.str().c_str());
+    return byte_count;
+}
+
+/**
+ *  pack_streamで詰めたバイト列をビット幅Wのデータ列に戻す(read_fileと同じ形式)
+ */
+template <typename T, int W>
+void unpack_stream(const unsigned char* bytes, size_t size, vector<T>& stream) {
+    unsigned int    data;
+    int             byte_pos;
+    int             data_pos;
+
+    data        = 0;
+    data_pos    = W;
+    stream.clear();
+    stream.reserve(size * 8 / W);
+    for (size_t i = 0;i < size;i++) {
+        for (byte_pos = 8;byte_pos > 0;byte_pos--) {
+            data    |= (bytes[i] >> (byte_pos - 1) & 0x1) << (data_pos - 1);
+            if (data_pos == 1) {
+                stream.push_back((T)data);
+                data        = 0;
+                data_pos    = W;
+            }
+            else {
+                data_pos    -= 1;
+            }
+        }
+    }
 }
 
-struct Stimulus {
-    vector<string>  list;
-    string          data_in_dir;
+//  実行時引数/リストファイル/シャード分割はlzss_stimulus.hのStimulusListを参照
+struct Stimulus :
+    public  StimulusList
+{
     string          code_out_dir;
     string          data_out_dir;
     string          dump_dir;
@@ -141,6 +458,13 @@ struct Stimulus {
         list.push_back(file);
     }
 
+    //  合成データ(create_source参照)
+    void add_synthetic(unsigned long long size, unsigned int seed) {
+        stringstream    name;
+        name << "synthetic:" << size << ":" << seed;
+        list.push_back(name.str());
+    }
+
     size_t list_size() {
         return list.size();
     }
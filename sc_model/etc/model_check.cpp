@@ -0,0 +1,203 @@
+/**
+ *  @file   model_check.cpp
+ *  @brief  エンコーダのSystemCモデル(LzssEnc)とCモデル(Lzss::encode)の一致確認
+ *
+ *  短いフレームを1つのLzssEncに連続して入力し、フレームごとのコードを
+ *  Lzss::encode(model_check_c.cpp)の結果と比較する。
+ *  フレームは次の3種類(フレームの終端と参照部が埋まる前の処理を重点的に確認する)。
+ *      - "abc"の3文字からなる長さ1 - 7の全系列
+ *      - 長さ1 - 3 * window_sizeの擬似乱数系列(2 - 4文字)
+ *      - 長さ1 - 1024の擬似乱数系列(Lzss::encodeのバッファ処理側)
+ *  RTLシミュレーション(sim/cpp)の期待値はLzss::encodeで作るため、ここで一致していることが前提となる。
+ *  ビルドと実行はrun_model_check.sh。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "systemc.h"
+#include "lzss_type.h"
+#include "lzss_enc.h"
+
+using namespace std;
+using namespace sc_core;
+using namespace sc_dt;
+
+#ifndef REFERENCE_SIZE
+#define REFERENCE_SIZE  64
+#endif
+
+#ifndef CODING_SIZE
+#define CODING_SIZE 5
+#endif
+
+#ifndef MAX_ERROR_NUM
+#define MAX_ERROR_NUM   10
+#endif
+
+//  model_check_c.cpp
+void c_model_encode(const vector<unsigned int>& data, vector<unsigned int>& codes);
+
+template <int reference_size = 32, int coding_size = 9>
+class ModelCheck :
+    public  sc_module
+{
+    LzssTypeDefine(reference_size, coding_size)
+
+    typedef vector<unsigned int>    frame_t;
+
+public:
+    typedef ModelCheck<reference_size, coding_size> SC_CURRENT_USER_MODULE;
+    ModelCheck(const sc_module_name& name);
+
+protected:
+    sc_fifo<data_packet_t>                  data_fifo;
+    sc_fifo<code_packet_t>                  code_fifo;
+    LzssEnc<reference_size, coding_size>    enc;
+
+    vector<frame_t>         frames;
+    unsigned int            random_state;
+
+    void data_thread();
+    void code_thread();
+    void make_frames();
+    void make_random_frames(int count, int max_size);
+    unsigned int random();
+};
+
+template <int reference_size, int coding_size>
+ModelCheck<reference_size, coding_size>::ModelCheck(const sc_module_name& name) :
+    sc_module       (name),
+    data_fifo       (16),
+    code_fifo       (16),
+    enc             ("enc"),
+    random_state    (0x12345678)
+{
+    SC_THREAD(data_thread);
+    SC_THREAD(code_thread);
+
+    enc.data_in_if(data_fifo);
+    enc.code_out_if(code_fifo);
+
+    make_frames();
+}
+
+template <int reference_size, int coding_size>
+void ModelCheck<reference_size, coding_size>::data_thread() {
+    data_packet_t   data;
+
+    for (size_t i = 0;i < frames.size();i++) {
+        for (size_t j = 0;j < frames[i].size();j++) {
+            data.value  = frames[i][j];
+            data.last   = (j + 1) == frames[i].size();
+            data_fifo.write(data);
+        }
+    }
+}
+
+template <int reference_size, int coding_size>
+void ModelCheck<reference_size, coding_size>::code_thread() {
+    code_packet_t   code;
+    frame_t         expected;
+    frame_t         actual;
+    stringstream    message;
+
+    for (size_t i = 0;i < frames.size();i++) {
+        c_model_encode(frames[i], expected);
+        actual.clear();
+        do {
+            code_fifo.read(code);
+            actual.push_back(code.value.to_uint());
+        } while (!code.last);
+
+        if (actual != expected) {
+            message.str("");
+            message << "Mismatch : frame " << i << " size " << frames[i].size() << hex << "\ndata    :";
+            for (size_t j = 0;(j < frames[i].size()) && (j < 32);j++) {
+                message << " " << frames[i][j];
+            }
+            message << "\nLzss    :";
+            for (size_t j = 0;(j < expected.size()) && (j < 32);j++) {
+                message << " " << expected[j];
+            }
+            message << "\nLzssEnc :";
+            for (size_t j = 0;(j < actual.size()) && (j < 32);j++) {
+                message << " " << actual[j];
+            }
+            SC_REPORT_ERROR(name(), message.str().c_str());
+        }
+    }
+
+    message.str("");
+    message << frames.size() << " frames checked";
+    SC_REPORT_INFO(name(), message.str().c_str());
+    sc_stop();
+}
+
+template <int reference_size, int coding_size>
+void ModelCheck<reference_size, coding_size>::make_frames() {
+    //  "abc"の全系列
+    for (int size = 1;size <= 7;size++) {
+        int count   = 1;
+        for (int i = 0;i < size;i++) {
+            count  *= 3;
+        }
+        for (int n = 0;n < count;n++) {
+            frame_t frame;
+            for (int i = 0, x = n;i < size;i++, x /= 3) {
+                frame.push_back('a' + (x % 3));
+            }
+            frames.push_back(frame);
+        }
+    }
+
+    make_random_frames(2000, 3 * constants::window_size);
+    make_random_frames(100, 1024);
+}
+
+template <int reference_size, int coding_size>
+void ModelCheck<reference_size, coding_size>::make_random_frames(int count, int max_size) {
+    for (int n = 0;n < count;n++) {
+        frame_t frame(1 + (random() % max_size));
+        int     symbols = 2 + (n % 3);
+        for (size_t i = 0;i < frame.size();i++) {
+            frame[i]    = 'a' + (random() % symbols);
+        }
+        frames.push_back(frame);
+    }
+}
+
+/**
+ *  擬似乱数(xorshift32、結果は再現する)
+ */
+template <int reference_size, int coding_size>
+unsigned int ModelCheck<reference_size, coding_size>::random() {
+    random_state   ^= random_state << 13;
+    random_state   ^= random_state >> 17;
+    random_state   ^= random_state << 5;
+    return random_state;
+}
+
+int sc_main(int argc, char* argv[]) {
+    sc_report_handler::stop_after(SC_ERROR, MAX_ERROR_NUM);
+    sc_report_handler::set_actions(SC_ERROR, SC_DISPLAY);
+    sc_report_handler::set_actions(SC_FATAL, SC_DISPLAY | SC_STOP);
+
+    ModelCheck<REFERENCE_SIZE, CODING_SIZE> check("check");
+    sc_start();
+
+    cout << "------------------------------------------------"   << endl;
+    cout << "Message Information"                                << endl;
+    cout << "Info  : " << sc_report_handler::get_count(SC_INFO)  << endl;
+    cout << "Error : " << sc_report_handler::get_count(SC_ERROR) << endl;
+    cout << "Fatal : " << sc_report_handler::get_count(SC_FATAL) << endl;
+
+    return ((sc_report_handler::get_count(SC_ERROR) + sc_report_handler::get_count(SC_FATAL)) == 0) ? 0 : 1;
+}
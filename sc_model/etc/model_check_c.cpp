@@ -0,0 +1,38 @@
+/**
+ *  @file   model_check_c.cpp
+ *  @brief  model_check.cpp用のCモデル(Lzss::encode)呼び出し
+ *
+ *  c_model/include/utility.hとsc_model/etc/lzss_utility.hはいずれもLog2を定義するため、
+ *  Cモデルは別の翻訳単位でインクルードする。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#include <vector>
+#include "lzss.h"
+
+using namespace std;
+
+#ifndef REFERENCE_SIZE
+#define REFERENCE_SIZE  64
+#endif
+
+#ifndef CODING_SIZE
+#define CODING_SIZE 5
+#endif
+
+void c_model_encode(const vector<unsigned int>& data, vector<unsigned int>& codes) {
+    typedef Lzss<REFERENCE_SIZE, CODING_SIZE>   model_t;
+
+    model_t                     model;
+    data_stream_t               input(data.begin(), data.end());
+    model_t::code_stream_t*     output  = model.encode(&input);
+
+    codes.assign(output->begin(), output->end());
+    delete  output;
+}
@@ -0,0 +1,68 @@
+#!/bin/sh
+#
+#   @file   run_model_check.sh
+#   @brief  SystemCモデルとCモデルの一致確認(model_check.cpp)をビルドして実行する
+#
+#   usage : run_model_check.sh [-r reference_size] [-c coding_size] [-w work_dir]
+#
+#   SystemCはSYSTEMC_HOME(include/とlib/またはlib-linux64/)を使用する。
+#   work_dir/r<reference_size>_c<coding_size>/model_checkを作成して実行し、
+#   不一致があった場合は終了コード1を返す。
+#
+#   @par    Copyright
+#   (C) 2012 Taichi Ishitani All Rights Reserved.
+#
+#   @author Taichi Ishitani
+#
+#   @date   0.0.00  2026/10/19  T. Ishitani     coding start
+#
+
+usage() {
+    echo "usage : $0 [-r reference_size] [-c coding_size] [-w work_dir]" 1>&2
+    exit 2
+}
+
+absolute_path() {
+    case "$1" in
+        /*) echo "$1" ;;
+        *)  echo "`pwd`/$1" ;;
+    esac
+}
+
+etc_dir=`dirname "$0"`
+etc_dir=`cd "$etc_dir" && pwd`
+sc_dir=$etc_dir/..
+
+reference_size=64
+coding_size=5
+work_dir=./model_check
+
+while getopts r:c:w: option; do
+    case $option in
+        r)  reference_size=$OPTARG ;;
+        c)  coding_size=$OPTARG ;;
+        w)  work_dir=$OPTARG ;;
+        *)  usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+[ -n "$SYSTEMC_HOME" ] || { echo "SYSTEMC_HOME is not set" 1>&2; exit 2; }
+
+work_dir=`absolute_path "$work_dir"`
+dir=$work_dir/r${reference_size}_c${coding_size}
+defines="-DREFERENCE_SIZE=$reference_size -DCODING_SIZE=$coding_size"
+
+echo "Build : reference_size $reference_size coding_size $coding_size"
+rm -rf "$dir"
+mkdir -p "$dir"
+#   Log2がc_model/include/utility.hとlzss_utility.hで重複するため、翻訳単位を分ける
+g++ -O2 $defines -I$sc_dir/../c_model/include \
+    -c $etc_dir/model_check_c.cpp -o "$dir/model_check_c.o" || exit 1
+g++ -O2 $defines -I$SYSTEMC_HOME/include -I$sc_dir/model -I$sc_dir/etc \
+    -c $etc_dir/model_check.cpp -o "$dir/model_check.o" || exit 1
+g++ -o "$dir/model_check" "$dir/model_check.o" "$dir/model_check_c.o" \
+    -L$SYSTEMC_HOME/lib -L$SYSTEMC_HOME/lib-linux64 -Wl,-rpath,$SYSTEMC_HOME/lib -Wl,-rpath,$SYSTEMC_HOME/lib-linux64 \
+    -lsystemc -lpthread || exit 1
+
+cd "$dir" && ./model_check
@@ -0,0 +1,137 @@
+#!/bin/sh
+#
+#   @file   run_regression.sh
+#   @brief  スティミュラスリストを分割し、複数のシミュレータプロセスで並列に実行する
+#
+#   usage : run_regression.sh [-j jobs] [-w work_dir] [-i input_dir] [-l list_file] simulator [stimulus ...]
+#
+#   simulatorはsc_model/sim/sim_cpp(sim/etc/build_cpp.sh)のいずれの実行ファイルでもよい。
+#   各シャードはwork_dir/shard<n>で "-s <n>/<jobs>" を付けて実行し、
+#   終了後にMessage Informationの件数を合算して表示する。
+#
+#   @par    Copyright
+#   (C) 2012 Taichi Ishitani All Rights Reserved.
+#
+#   @author Taichi Ishitani
+#
+#   @date   0.0.00  2026/10/19  T. Ishitani     coding start
+#
+
+usage() {
+    echo "usage : $0 [-j jobs] [-w work_dir] [-i input_dir] [-l list_file] simulator [stimulus ...]" 1>&2
+    exit 2
+}
+
+absolute_path() {
+    case "$1" in
+        /*) echo "$1" ;;
+        *)  echo "`pwd`/$1" ;;
+    esac
+}
+
+jobs=`nproc 2>/dev/null || echo 1`
+work_dir=./regression
+input_dir=../sample
+list_file=
+
+while getopts j:w:i:l: option; do
+    case $option in
+        j)  jobs=$OPTARG ;;
+        w)  work_dir=$OPTARG ;;
+        i)  input_dir=$OPTARG ;;
+        l)  list_file=$OPTARG ;;
+        *)  usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+[ $# -ge 1 ] || usage
+[ "$jobs" -ge 1 ] 2>/dev/null || usage
+simulator=`absolute_path "$1"`
+shift
+
+input_dir=`absolute_path "$input_dir"`
+if [ -n "$list_file" ]; then
+    list_file=`absolute_path "$list_file"`
+fi
+work_dir=`absolute_path "$work_dir"`
+
+#   シャードの起動
+start=`date +%s.%N`
+shard=0
+while [ $shard -lt $jobs ]; do
+    dir=$work_dir/shard$shard
+    rm -rf "$dir"
+    mkdir -p "$dir/encode" "$dir/decode" "$dir/dump"
+    (
+        cd "$dir" &&
+        if [ -n "$list_file" ]; then
+            "$simulator" -i "$input_dir" -l "$list_file" -s $shard/$jobs "$@"
+        else
+            "$simulator" -i "$input_dir" -s $shard/$jobs "$@"
+        fi > log 2>&1
+        echo $? > status
+    ) &
+    shard=`expr $shard + 1`
+done
+wait
+end=`date +%s.%N`
+
+#   結果の集計
+shard=0
+summary=
+while [ $shard -lt $jobs ]; do
+    summary="$summary $work_dir/shard$shard"
+    shard=`expr $shard + 1`
+done
+
+awk -v start=$start -v end=$end -v jobs=$jobs '
+    function count(file, name,    line, value) {
+        value = -1
+        while ((getline line < file) > 0) {
+            if (line ~ ("^" name " *: [0-9]+$")) {
+                sub("^" name " *: *", "", line)
+                value = line + 0
+            }
+        }
+        close(file)
+        return value
+    }
+    BEGIN {
+        print "------------------------------------------------"
+        print "Regression Summary"
+        for (i = 1;i < ARGC;i++) {
+            log_file    = ARGV[i] "/log"
+            info        = count(log_file, "Info")
+            error       = count(log_file, "Error")
+            fatal       = count(log_file, "Fatal")
+            #   ステータスファイルが読めない場合(getlineが0以下)も異常終了とみなす
+            status      = ""
+            if ((getline status < (ARGV[i] "/status")) <= 0) {
+                status  = "none"
+            }
+            close(ARGV[i] "/status")
+
+            #   件数が出力されていない場合は異常終了とみなす
+            if ((info < 0) || (error < 0) || (fatal < 0) || (status != 0)) {
+                printf("%-40s : abnormal exit (status %s)\n", ARGV[i], status)
+                info    = (info  < 0) ? 0 : info
+                error   = (error < 0) ? 0 : error
+                fatal   = (fatal < 0) ? 1 : fatal + ((status != 0) ? 1 : 0)
+            }
+            else {
+                printf("%-40s : Info %d Error %d Fatal %d\n", ARGV[i], info, error, fatal)
+            }
+            total_info  += info
+            total_error += error
+            total_fatal += fatal
+        }
+        print "------------------------------------------------"
+        print "Shards : " jobs
+        print "Info   : " total_info
+        print "Error  : " total_error
+        print "Fatal  : " total_fatal
+        printf("Time   : %.2f s\n", end - start)
+        exit ((total_error + total_fatal) > 0) ? 1 : 0
+    }
+' $summary
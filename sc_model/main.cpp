@@ -10,9 +10,11 @@
  *  @date   0.0.00  2012/06/18  T. Ishitani     coding start
  */
 
+#include <iostream>
 #include "systemc.h"
 #include "top.h"
 
+using namespace std;
 using namespace sc_core;
 using namespace sc_dt;
 
@@ -36,9 +38,29 @@ using namespace sc_dt;
 #define CODING_SIZE 5
 #endif
 
+#ifdef LENGTH_EXTENSION
+#define LENGTH_EXTENSION_ENABLE true
+#else
+#define LENGTH_EXTENSION_ENABLE false
+#endif
+
+#ifndef MAX_ERROR_NUM
+#define MAX_ERROR_NUM   10
+#endif
+
 int sc_main(int argc, char* argv[]) {
-    Top<REFERENCE_SIZE, CODING_SIZE>    top("top", CYCLE_TIME, TIME_OUT, TIME_UNIT);
+    sc_report_handler::stop_after(SC_ERROR, MAX_ERROR_NUM);
+    sc_report_handler::set_actions(SC_ERROR, SC_DISPLAY);
+    sc_report_handler::set_actions(SC_FATAL, SC_DISPLAY | SC_STOP);
+
+    Top<REFERENCE_SIZE, CODING_SIZE>    top("top", CYCLE_TIME, TIME_OUT, TIME_UNIT, LENGTH_EXTENSION_ENABLE);
     sc_start();
 
+    cout << "------------------------------------------------"   << endl;
+    cout << "Message Information"                                << endl;
+    cout << "Info  : " << sc_report_handler::get_count(SC_INFO)  << endl;
+    cout << "Error : " << sc_report_handler::get_count(SC_ERROR) << endl;
+    cout << "Fatal : " << sc_report_handler::get_count(SC_FATAL) << endl;
+
     return 0;
 }
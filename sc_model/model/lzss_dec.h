@@ -30,16 +30,27 @@ class LzssDec :
 
     typedef vector<data_t>  data_buffer_t;
 
+    //  METHOD_PROCESS時の処理状態
+    enum State {
+        Input,
+        Literal,
+        Match,
+        ExtensionInput,
+        LastMatch
+    };
+
 public:
     sc_port<code_in_if_t>   code_in_if;
     sc_port<data_out_if_t>  data_out_if;
 
     typedef LzssDec<reference_size, coding_size>    SC_CURRENT_USER_MODULE;
-    LzssDec(const sc_module_name& name);
+    LzssDec(const sc_module_name& name, bool length_extension = false);
 
     virtual void trace(sc_trace_file* tr) const;
 
 protected:
+    const bool      length_extension;
+
     code_packet_t   input_code;
     data_packet_t   output_data;
 
@@ -49,17 +60,35 @@ protected:
 
     data_buffer_t   data_buffer;
 
+    State           state;
+    unsigned int    remain;
+    bool            extend;
+
     void main_thread();
+    void main_method();
+    void decode();
+    void decode_extension();
+    void set_match_data(bool last);
+    void output_match_data(bool last);
+    void finish_code();
     void update_buffer();
     void clear_buffer();
 };
 
 template <int reference_size, int coding_size>
-LzssDec<reference_size, coding_size>::LzssDec(const sc_module_name& name) :
-    sc_module   (name),
-    data_buffer (reference_size)
+LzssDec<reference_size, coding_size>::LzssDec(const sc_module_name& name, bool length_extension) :
+    sc_module       (name),
+    length_extension(length_extension),
+    data_buffer     (reference_size),
+    state           (Input),
+    remain          (0),
+    extend          (false)
 {
+#ifdef METHOD_PROCESS
+    SC_METHOD(main_method);
+#else
     SC_THREAD(main_thread);
+#endif
 }
 
 template <int reference_size, int coding_size>
@@ -78,41 +107,146 @@ void LzssDec<reference_size, coding_size>::main_thread() {
         code_in_if->read(input_code);
 
         //  デコード
-        flag    = input_code.value[constants::code_width - 1];
+        decode();
         if (flag) {
-            offset  = input_code.value.range(constants::code_width   - 2, constants::length_width);
-            length  = input_code.value.range(constants::length_width - 1, 0);
+            //  一致長延長時は後続の延長コードを確認するまで最終データの出力を保留
+            while (true) {
+                for (;remain > 1;remain--) {
+                    output_match_data(false);
+                }
+                if (!extend) {
+                    break;
+                }
 
-            for (int shift = (length + 2);shift > 0;shift--) {
-                //  出力
-                output_data.value   = data_buffer[offset];
-                output_data.last    = (input_code.last && (shift == 1));
-                data_out_if->write(output_data);
-
-                //  バッファ更新
-                update_buffer();
+                //  延長コード入力
+                code_in_if->read(input_code);
+                decode_extension();
             }
+            output_match_data(input_code.last);
         }
         else {
-            offset  = 0;
-            length  = 0;
-
             //  出力
-            output_data.value   = input_code.value.range(constants::data_width - 1, 0);
-            output_data.last    = input_code.last;
             data_out_if->write(output_data);
 
             //  バッファ更新
             update_buffer();
         }
 
-        //  バッファクリア
-        if (input_code.last) {
-            clear_buffer();
+        finish_code();
+    }
+}
+
+/**
+ *  main_threadと同じ処理をSC_METHODで行う。
+ *  FIFOの読み書きができる間は1回の起動で処理を続け、
+ *  できなくなった時点でdata_written_event/data_read_eventを待つ。
+ */
+template <int reference_size, int coding_size>
+void LzssDec<reference_size, coding_size>::main_method() {
+    while (true) {
+        switch (state) {
+        case Input:
+            if (!code_in_if->nb_read(input_code)) {
+                next_trigger(code_in_if->data_written_event());
+                return;
+            }
+            decode();
+            state   = (flag) ? Match : Literal;
+            break;
+        case Literal:
+            if (!data_out_if->nb_write(output_data)) {
+                next_trigger(data_out_if->data_read_event());
+                return;
+            }
+            update_buffer();
+            finish_code();
+            break;
+        case Match:
+            if (remain > 1) {
+                set_match_data(false);
+                if (!data_out_if->nb_write(output_data)) {
+                    next_trigger(data_out_if->data_read_event());
+                    return;
+                }
+                update_buffer();
+                remain  -= 1;
+            }
+            else {
+                state   = (extend) ? ExtensionInput : LastMatch;
+            }
+            break;
+        case ExtensionInput:
+            if (!code_in_if->nb_read(input_code)) {
+                next_trigger(code_in_if->data_written_event());
+                return;
+            }
+            decode_extension();
+            state   = Match;
+            break;
+        case LastMatch:
+            set_match_data(input_code.last);
+            if (!data_out_if->nb_write(output_data)) {
+                next_trigger(data_out_if->data_read_event());
+                return;
+            }
+            update_buffer();
+            finish_code();
+            break;
         }
     }
 }
 
+template <int reference_size, int coding_size>
+void LzssDec<reference_size, coding_size>::decode() {
+    flag    = input_code.value[constants::code_width - 1];
+    if (flag) {
+        offset  = input_code.value.range(constants::code_width   - 2, constants::length_width);
+        length  = input_code.value.range(constants::length_width - 1, 0);
+        remain  = length + 2;
+        extend  = length_extension && (remain == coding_size);
+    }
+    else {
+        offset  = 0;
+        length  = 0;
+        output_data.value   = input_code.value.range(constants::data_width - 1, 0);
+        output_data.last    = input_code.last;
+    }
+}
+
+template <int reference_size, int coding_size>
+void LzssDec<reference_size, coding_size>::decode_extension() {
+    unsigned int    extension;
+
+    extension   = input_code.value.range(constants::extension_width - 1, 0);
+    remain      += extension;
+    extend      = (extension == constants::extension_max);
+}
+
+template <int reference_size, int coding_size>
+void LzssDec<reference_size, coding_size>::set_match_data(bool last) {
+    output_data.value   = data_buffer[offset];
+    output_data.last    = last;
+}
+
+template <int reference_size, int coding_size>
+void LzssDec<reference_size, coding_size>::output_match_data(bool last) {
+    //  出力
+    set_match_data(last);
+    data_out_if->write(output_data);
+
+    //  バッファ更新
+    update_buffer();
+}
+
+template <int reference_size, int coding_size>
+void LzssDec<reference_size, coding_size>::finish_code() {
+    //  バッファクリア
+    if (input_code.last) {
+        clear_buffer();
+    }
+    state   = Input;
+}
+
 template <int reference_size, int coding_size>
 void LzssDec<reference_size, coding_size>::update_buffer() {
     data_buffer.erase(data_buffer.begin());
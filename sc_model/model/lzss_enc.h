@@ -49,18 +49,34 @@ class LzssEnc :
 
     typedef BufferData              buffer_data_t;
     typedef vector<buffer_data_t>   data_buffer_t;
-    typedef vector<int>             length_buffer_t;
+    typedef vector<int64>           position_buffer_t;
+
+    //  データバッファはwindow_size以上の2のべき乗サイズのリングバッファ
+    static const int    ring_size   = 1 << Log2<2 * constants::window_size - 1>::value;
+    static const int    ring_mask   = ring_size - 1;
+    //  先頭2データのハッシュによる候補位置の索引
+    static const int    hash_size   = 4096;
+
+    //  METHOD_PROCESS時の処理状態
+    enum State {
+        Shift,
+        Output,
+        Extension,
+        ExtensionOutput
+    };
 
 public:
     sc_port<data_in_if_t>   data_in_if;
     sc_port<code_out_if_t>  code_out_if;
 
     typedef LzssEnc<reference_size, coding_size>    SC_CURRENT_USER_MODULE;
-    LzssEnc(const sc_module_name& name);
+    LzssEnc(const sc_module_name& name, bool length_extension = false);
 
     virtual void trace(sc_trace_file* tr) const;
 
 protected:
+    const bool      length_extension;
+
     data_packet_t   input_data;
     code_packet_t   output_code;
 
@@ -68,21 +84,66 @@ protected:
     length_t        length;
     offset_t        offset;
 
-    data_buffer_t   data_buffer;
-    length_buffer_t length_buffer;
+    data_buffer_t       data_buffer;
+    position_buffer_t   hash_head;
+    position_buffer_t   hash_prev;
+    int64               position;
+    int64               frame_start;
+    int                 match_offset;
+    int                 match_length;
+
+    State           state;
+    int             shift;
+    bool            last_done;
+    bool            last_flag;
+    bool            extend;
+    int             distance;
+    unsigned int    extension;
 
     void main_thread();
+    void main_method();
+    void shift_buffer(bool update_length);
+    void encode();
+    bool extension_matched();
+    void encode_extension();
+    void finish_code();
     void update_buffer(bool with_new_data, bool update_length);
+    void update_match();
     void clear_buffer();
+
+    buffer_data_t& window_data(int index) {
+        return data_buffer[(position - constants::window_size + index) & ring_mask];
+    }
+
+    static int hash(const data_t& d1, const data_t& d2) {
+        return ((d1.to_uint() << 4) ^ d2.to_uint()) & (hash_size - 1);
+    }
 };
 
 template <int reference_size, int coding_size>
-LzssEnc<reference_size, coding_size>::LzssEnc(const sc_module_name& name) :
+LzssEnc<reference_size, coding_size>::LzssEnc(const sc_module_name& name, bool length_extension) :
     sc_module       (name),
-    data_buffer     (constants::window_size),
-    length_buffer   (reference_size)
+    length_extension(length_extension),
+    data_buffer     (ring_size),
+    hash_head       (hash_size, -1),
+    hash_prev       (ring_size, -1),
+    position        (0),
+    frame_start     (0),
+    match_offset    (0),
+    match_length    (1),
+    state           (Shift),
+    shift           (coding_size + 1),
+    last_done       (false),
+    last_flag       (false),
+    extend          (false),
+    distance        (0),
+    extension       (0)
 {
+#ifdef METHOD_PROCESS
+    SC_METHOD(main_method);
+#else
     SC_THREAD(main_thread);
+#endif
 }
 
 template <int reference_size, int coding_size>
@@ -96,16 +157,6 @@ void LzssEnc<reference_size, coding_size>::trace(sc_trace_file* tr) const {
 
 template <int reference_size, int coding_size>
 void LzssEnc<reference_size, coding_size>::main_thread() {
-    int     shift;
-    bool    last_done;
-    bool    update_length;
-    int     max_offset;
-    int     max_length;
-    code_t  code;
-    bool    last_flag;
-
-    shift       = coding_size + 1;
-    last_done   = false;
     while (true) {
         while (shift > 0) {
             shift   -= 1;
@@ -116,77 +167,179 @@ void LzssEnc<reference_size, coding_size>::main_thread() {
             }
 
             //  バッファ更新
-            update_length   = (shift == 0) ? true : false;
-            update_buffer(!last_done, update_length);
-            last_done       = input_data.last;
+            shift_buffer(shift == 0);
         }
 
-        //  最長一致系列の検索
-        max_offset  = 0;
-        max_length  = 1;
-        for (int i = 0;i < reference_size;i++) {
-            if (max_length <= length_buffer[i]) {
-                max_length  = length_buffer[i];
-                max_offset  = i;
-            }
-        }
+        //  エンコード/出力
+        encode();
+        code_out_if->write(output_code);
 
-        //  エンコード
-        flag    = (max_length > 1);;
-        if (flag) {
-            offset  = max_offset;
-            length  = max_length - 2;
-            code    = (flag, offset, length);
-            shift   = max_length;
-        }
-        else {
-            offset  = 0;
-            length  = 0;
-            code    = (flag, data_buffer[reference_size - 1].data);
-            shift   = 1;
-        }
-        if (last_done && (!data_buffer[reference_size + max_length - 1].valid)) {
-            last_flag   = true;
-        }
-        else {
-            last_flag   = false;
+        //  一致長の延長
+        if (extend) {
+            do {
+                extension   = 0;
+                while ((extension < constants::extension_max) && extension_matched()) {
+                    if (!last_done) {
+                        data_in_if->read(input_data);
+                    }
+                    shift_buffer(false);
+                    extension   += 1;
+                }
+                encode_extension();
+                code_out_if->write(output_code);
+            } while (extension == constants::extension_max);
         }
 
-        //  出力
-        output_code.value   = code;
-        output_code.last    = last_flag;
-        code_out_if->write(output_code);
+        finish_code();
+    }
+}
+
+/**
+ *  main_threadと同じ処理をSC_METHODで行う。
+ *  FIFOの読み書きができる間は1回の起動で処理を続け、
+ *  できなくなった時点でdata_written_event/data_read_eventを待つ。
+ */
+template <int reference_size, int coding_size>
+void LzssEnc<reference_size, coding_size>::main_method() {
+    while (true) {
+        switch (state) {
+        case Shift:
+            if (shift == 0) {
+                encode();
+                state   = Output;
+                break;
+            }
+
+            //  データ入力
+            if ((!last_done) && (!data_in_if->nb_read(input_data))) {
+                next_trigger(data_in_if->data_written_event());
+                return;
+            }
 
-        //  バッファクリア
-        if (last_flag) {
-            clear_buffer();
-            shift       = coding_size + 1;
-            last_done   = false;
+            //  バッファ更新
+            shift   -= 1;
+            shift_buffer(shift == 0);
+            break;
+        case Output:
+            if (!code_out_if->nb_write(output_code)) {
+                next_trigger(code_out_if->data_read_event());
+                return;
+            }
+            if (extend) {
+                extension   = 0;
+                state       = Extension;
+            }
+            else {
+                finish_code();
+            }
+            break;
+        case Extension:
+            if ((extension < constants::extension_max) && extension_matched()) {
+                if ((!last_done) && (!data_in_if->nb_read(input_data))) {
+                    next_trigger(data_in_if->data_written_event());
+                    return;
+                }
+                shift_buffer(false);
+                extension   += 1;
+            }
+            else {
+                encode_extension();
+                state   = ExtensionOutput;
+            }
+            break;
+        case ExtensionOutput:
+            if (!code_out_if->nb_write(output_code)) {
+                next_trigger(code_out_if->data_read_event());
+                return;
+            }
+            if (extension == constants::extension_max) {
+                extension   = 0;
+                state       = Extension;
+            }
+            else {
+                finish_code();
+            }
+            break;
         }
     }
 }
 
+template <int reference_size, int coding_size>
+void LzssEnc<reference_size, coding_size>::shift_buffer(bool update_length) {
+    update_buffer(!last_done, update_length);
+    last_done   = input_data.last;
+}
+
+/**
+ *  最長一致系列の検索結果からコードを生成する
+ */
+template <int reference_size, int coding_size>
+void LzssEnc<reference_size, coding_size>::encode() {
+    code_t  code;
+
+    flag    = (match_length > 1);
+    if (flag) {
+        offset  = match_offset;
+        length  = match_length - 2;
+        code    = (flag, offset, length);
+        shift   = match_length;
+    }
+    else {
+        offset  = 0;
+        length  = 0;
+        code    = (flag, window_data(reference_size - 1).data);
+        shift   = 1;
+    }
+    if (last_done && (!window_data(reference_size + match_length - 1).valid)) {
+        last_flag   = true;
+    }
+    else {
+        last_flag   = false;
+    }
+
+    //  一致長延長時はラストを延長コードで出力
+    extend      = length_extension && flag && (match_length == coding_size);
+    distance    = reference_size - match_offset;
+
+    output_code.value   = code;
+    output_code.last    = last_flag && (!extend);
+}
+
+/**
+ *  一致系列の次のデータ(window_data(window_size - 1))が同じ距離の参照データと一致するか
+ */
+template <int reference_size, int coding_size>
+bool LzssEnc<reference_size, coding_size>::extension_matched() {
+    return (window_data(constants::window_size - 1) == window_data(constants::window_size - 1 - distance));
+}
+
+template <int reference_size, int coding_size>
+void LzssEnc<reference_size, coding_size>::encode_extension() {
+    last_flag   = last_done && (!window_data(constants::window_size - 1).valid);
+
+    output_code.value   = (flag_t(1), extension_t(extension));
+    output_code.last    = last_flag && (extension != constants::extension_max);
+}
+
+template <int reference_size, int coding_size>
+void LzssEnc<reference_size, coding_size>::finish_code() {
+    //  バッファクリア
+    if (last_flag) {
+        clear_buffer();
+        shift       = coding_size + 1;
+        last_done   = false;
+    }
+    state   = Shift;
+}
+
 template <int reference_size, int coding_size>
 void LzssEnc<reference_size, coding_size>::update_buffer(bool with_new_data, bool update_length) {
     buffer_data_t   new_data;
+    int64           latest;
 
-    //  一致長バッファのアップデート
+    //  一致長のアップデート
     if (update_length) {
-        length_buffer.clear();
-        for (int offset_pos = 0;offset_pos < reference_size;offset_pos++) {
-            int matching_length = 0;
-            for (int i = 0;i < coding_size;i++) {
-                buffer_data_t&  d1  = data_buffer[offset_pos     + i];
-                buffer_data_t&  d2  = data_buffer[reference_size + i];
-                if (d1 == d2) {
-                    matching_length += 1;
-                }
-                else {
-                    break;
-                }
-            }
-            length_buffer.push_back(matching_length);
-        }
+        update_match();
     }
 
     //  データバッファのアップデート
@@ -194,17 +347,64 @@ void LzssEnc<reference_size, coding_size>::update_buffer(bool with_new_data, boo
         new_data.data   = input_data.value;
         new_data.valid  = true;
     }
-    data_buffer.erase(data_buffer.begin());
-    data_buffer.push_back(new_data);
+    data_buffer[position & ring_mask]   = new_data;
+    position    += 1;
+
+    //  直前の位置を索引に登録
+    latest  = position - 1;
+    if (data_buffer[(latest - 1) & ring_mask].valid && data_buffer[latest & ring_mask].valid) {
+        int h   = hash(data_buffer[(latest - 1) & ring_mask].data, data_buffer[latest & ring_mask].data);
+        hash_prev[(latest - 1) & ring_mask] = hash_head[h];
+        hash_head[h]                        = latest - 1;
+    }
+}
+
+/**
+ *  符号化位置(window_data(reference_size))に対する最長一致系列を検索する。
+ *  索引から新しい位置順に候補を辿るため、同じ一致長では最も大きいオフセットが選ばれる。
+ */
+template <int reference_size, int coding_size>
+void LzssEnc<reference_size, coding_size>::update_match() {
+    const int64 current = position - coding_size;
+    int64       candidate;
+    int         matching_length;
+
+    match_offset    = 0;
+    match_length    = 1;
+
+    buffer_data_t&  d1  = data_buffer[(current + 0) & ring_mask];
+    buffer_data_t&  d2  = data_buffer[(current + 1) & ring_mask];
+    if (!(d1.valid && d2.valid)) {
+        return;
+    }
+
+    candidate   = hash_head[hash(d1.data, d2.data)];
+    while ((candidate >= frame_start) && (candidate >= (current - reference_size))) {
+        if (candidate < current) {
+            matching_length = 0;
+            while ((matching_length < coding_size) &&
+                   (data_buffer[(candidate + matching_length) & ring_mask] == data_buffer[(current + matching_length) & ring_mask])) {
+                matching_length += 1;
+            }
+            if (matching_length > match_length) {
+                match_length    = matching_length;
+                match_offset    = reference_size - (int)(current - candidate);
+                if (match_length == coding_size) {
+                    break;
+                }
+            }
+        }
+        candidate   = hash_prev[candidate & ring_mask];
+    }
 }
 
 template <int reference_size, int coding_size>
 void LzssEnc<reference_size, coding_size>::clear_buffer() {
     data_buffer.clear();
-    data_buffer.assign(constants::window_size, buffer_data_t());
-
-    length_buffer.clear();
-    length_buffer.assign(reference_size, 0);
+    data_buffer.assign(ring_size, buffer_data_t());
+    frame_start     = position;
+    match_offset    = 0;
+    match_length    = 1;
 }
 
 #endif /* LZSS_ENC_H_ */
@@ -17,6 +17,7 @@
 #include <iomanip>
 #include <string>
 #include "systemc.h"
+#include "lzss_uint.h"
 
 using namespace std;
 using namespace sc_core;
@@ -29,6 +30,11 @@ enum LzssPacketType {
 
 template <int w, LzssPacketType type>
 struct LzssPacket {
+    typedef typename LzssUint<w>::type  value_t;
+    typedef typename LzssUint<1>::type  last_t;
+
+    static const int    width   = w;
+
     LzssPacket() :
         value   (0      ),
         last    (false  )
@@ -53,14 +59,14 @@ struct LzssPacket {
         return ((value != rhs.value) || (last != rhs.last)) ? true : false;
     }
 
-    LzssPacket<w, type>& set(sc_uint<w>& other_value, bool other_last) {
+    LzssPacket<w, type>& set(value_t& other_value, bool other_last) {
         value   = other_value;
         last    = other_last;
         return *this;
     }
 
-    sc_uint<w>  value;
-    sc_uint<1>  last;
+    value_t     value;
+    last_t      last;
 };
 
 template <int w, LzssPacketType type>
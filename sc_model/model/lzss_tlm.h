@@ -0,0 +1,305 @@
+/**
+ *  @file   lzss_tlm.h
+ *  @brief  LzssEnc/LzssDecのTLM-2.0(LT)ラッパ
+ *
+ *  入力バッファに書き込んだデータを入力長レジスタへの書き込みで一括処理し、
+ *  結果を出力バッファに格納する。処理時間はサイクルモデルから見積もり、
+ *  waitせずにb_transportの遅延へ加算するため、イニシエータ側で
+ *  tlm_quantumkeeperによる時間分離ができる。入出力バッファはDMIでアクセスできる。
+ *
+ *  アドレスマップ
+ *      0x00000000 -    入力バッファ    (R/W)
+ *      0x40000000 -    出力バッファ    (R)
+ *      0x80000000      入力長(byte)    (R/W, 書き込みで処理開始)
+ *      0x80000004      出力長(byte)    (R)
+ *
+ *  エンコーダの出力/デコーダの入力はコード幅で上位ビットから詰めた形式(write_fileの出力と同じ)。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_TLM_H_
+#define LZSS_TLM_H_
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <stdint.h>
+#include "systemc.h"
+#include "tlm.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "lzss_type.h"
+#include "lzss_utility.h"
+#include "lzss_enc.h"
+#include "lzss_dec.h"
+
+using namespace std;
+using namespace sc_core;
+using namespace sc_dt;
+
+struct LzssTlmAddress {
+    static const uint64 input_buffer    = 0x00000000;
+    static const uint64 output_buffer   = 0x40000000;
+    static const uint64 input_size      = 0x80000000;
+    static const uint64 output_size     = 0x80000004;
+};
+
+/**
+ *  TLMラッパの共通部
+ *  内部FIFO経由でモデルに入力し、出力をすべて受け取るまでデルタサイクルのみで処理する。
+ */
+template <typename in_packet_t, typename out_packet_t>
+class LzssTlm :
+    public  sc_module
+{
+    typedef typename in_packet_t::value_t   in_value_t;
+    typedef typename out_packet_t::value_t  out_value_t;
+
+    static const int    fifo_size   = 256;
+
+public:
+    tlm_utils::simple_target_socket<LzssTlm>    socket;
+
+    LzssTlm(const sc_module_name& name, const sc_time& cycle_time, int latency, size_t input_buffer_size, size_t output_buffer_size);
+
+protected:
+    sc_fifo<in_packet_t>    in_fifo;
+    sc_fifo<out_packet_t>   out_fifo;
+
+    const sc_time           cycle_time;
+    const int               latency;
+
+    vector<unsigned char>   input_buffer;
+    vector<unsigned char>   output_buffer;
+    uint32_t                input_size;
+    uint32_t                output_size;
+
+    vector<in_value_t>      in_stream;
+    vector<out_value_t>     out_stream;
+
+    void b_transport(tlm::tlm_generic_payload& trans, sc_time& delay);
+    bool get_direct_mem_ptr(tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi);
+    bool process(sc_time& delay);
+
+    static bool in_range(uint64 address, unsigned int size, uint64 base, size_t buffer_size) {
+        return (address >= base) && ((address + size) <= (base + buffer_size));
+    }
+};
+
+template <typename in_packet_t, typename out_packet_t>
+LzssTlm<in_packet_t, out_packet_t>::LzssTlm(const sc_module_name& name, const sc_time& cycle_time, int latency, size_t input_buffer_size, size_t output_buffer_size) :
+    sc_module       (name),
+    socket          ("socket"),
+    in_fifo         (fifo_size),
+    out_fifo        (fifo_size),
+    cycle_time      (cycle_time),
+    latency         (latency),
+    input_buffer    (input_buffer_size),
+    output_buffer   (output_buffer_size),
+    input_size      (0),
+    output_size     (0)
+{
+    socket.register_b_transport(this, &LzssTlm::b_transport);
+    socket.register_get_direct_mem_ptr(this, &LzssTlm::get_direct_mem_ptr);
+}
+
+template <typename in_packet_t, typename out_packet_t>
+void LzssTlm<in_packet_t, out_packet_t>::b_transport(tlm::tlm_generic_payload& trans, sc_time& delay) {
+    const uint64        address = trans.get_address();
+    unsigned char*      data    = trans.get_data_ptr();
+    const unsigned int  size    = trans.get_data_length();
+
+    if (trans.get_byte_enable_ptr() != 0) {
+        trans.set_response_status(tlm::TLM_BYTE_ENABLE_ERROR_RESPONSE);
+        return;
+    }
+    if (trans.get_streaming_width() < size) {
+        trans.set_response_status(tlm::TLM_BURST_ERROR_RESPONSE);
+        return;
+    }
+
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    if (in_range(address, size, LzssTlmAddress::input_buffer, input_buffer.size())) {
+        //  入力バッファ
+        if (trans.is_write()) {
+            memcpy(&input_buffer[address - LzssTlmAddress::input_buffer], data, size);
+        }
+        else if (trans.is_read()) {
+            memcpy(data, &input_buffer[address - LzssTlmAddress::input_buffer], size);
+        }
+        trans.set_dmi_allowed(true);
+    }
+    else if (in_range(address, size, LzssTlmAddress::output_buffer, output_buffer.size())) {
+        //  出力バッファ
+        if (trans.is_write()) {
+            trans.set_response_status(tlm::TLM_COMMAND_ERROR_RESPONSE);
+            return;
+        }
+        else if (trans.is_read()) {
+            memcpy(data, &output_buffer[address - LzssTlmAddress::output_buffer], size);
+        }
+        trans.set_dmi_allowed(true);
+    }
+    else if ((address == LzssTlmAddress::input_size) && (size == sizeof(uint32_t))) {
+        //  入力長(書き込みで処理開始)
+        if (trans.is_write()) {
+            memcpy(&input_size, data, size);
+            if (!process(delay)) {
+                trans.set_response_status(tlm::TLM_GENERIC_ERROR_RESPONSE);
+            }
+        }
+        else if (trans.is_read()) {
+            memcpy(data, &input_size, size);
+        }
+    }
+    else if ((address == LzssTlmAddress::output_size) && (size == sizeof(uint32_t))) {
+        //  出力長
+        if (trans.is_write()) {
+            trans.set_response_status(tlm::TLM_COMMAND_ERROR_RESPONSE);
+            return;
+        }
+        else if (trans.is_read()) {
+            memcpy(data, &output_size, size);
+        }
+    }
+    else {
+        trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    }
+}
+
+template <typename in_packet_t, typename out_packet_t>
+bool LzssTlm<in_packet_t, out_packet_t>::get_direct_mem_ptr(tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi) {
+    const uint64    address = trans.get_address();
+
+    dmi.set_read_latency(SC_ZERO_TIME);
+    dmi.set_write_latency(SC_ZERO_TIME);
+    if (in_range(address, 1, LzssTlmAddress::input_buffer, input_buffer.size())) {
+        dmi.set_dmi_ptr(&input_buffer[0]);
+        dmi.set_start_address(LzssTlmAddress::input_buffer);
+        dmi.set_end_address(LzssTlmAddress::input_buffer + input_buffer.size() - 1);
+        dmi.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+        return true;
+    }
+    if (in_range(address, 1, LzssTlmAddress::output_buffer, output_buffer.size())) {
+        dmi.set_dmi_ptr(&output_buffer[0]);
+        dmi.set_start_address(LzssTlmAddress::output_buffer);
+        dmi.set_end_address(LzssTlmAddress::output_buffer + output_buffer.size() - 1);
+        dmi.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ *  入力バッファの内容をモデルで処理し、出力バッファに格納する。
+ *  遅延は 入出力の多い方の要素数 + レイテンシ サイクルとする。
+ */
+template <typename in_packet_t, typename out_packet_t>
+bool LzssTlm<in_packet_t, out_packet_t>::process(sc_time& delay) {
+    in_packet_t     in_packet;
+    out_packet_t    out_packet;
+    size_t          position;
+    bool            done;
+
+    output_size = 0;
+    if (input_size > input_buffer.size()) {
+        return false;
+    }
+    unpack_stream<in_value_t, in_packet_t::width>(&input_buffer[0], input_size, in_stream);
+    out_stream.clear();
+    if (in_stream.empty()) {
+        return true;
+    }
+
+    //  入力と出力の取りだしを交互に行い、どちらも進まない場合はモデルの処理を待つ
+    position    = 0;
+    done        = false;
+    while (!done) {
+        while ((position < in_stream.size()) && (in_fifo.num_free() > 0)) {
+            in_packet.value = in_stream[position];
+            in_packet.last  = (position == (in_stream.size() - 1));
+            in_fifo.nb_write(in_packet);
+            position    += 1;
+        }
+        while ((!done) && out_fifo.nb_read(out_packet)) {
+            out_stream.push_back(out_packet.value);
+            done    = out_packet.last;
+        }
+        if (!done) {
+            wait(in_fifo.data_read_event() | out_fifo.data_written_event());
+        }
+    }
+
+    if (((out_stream.size() * out_packet_t::width + 7) / 8) > output_buffer.size()) {
+        return false;
+    }
+    output_size = pack_stream<out_value_t, out_packet_t::width>(out_stream, &output_buffer[0]);
+    delay       += cycle_time * (double)(max(in_stream.size(), out_stream.size()) + latency);
+
+    return true;
+}
+
+/**
+ *  エンコーダ
+ */
+template <int reference_size = 32, int coding_size = 9>
+class LzssEncTlm :
+    public  LzssTlm<LzssPacket<LzssConstants<reference_size, coding_size>::data_width, Data>, LzssPacket<LzssConstants<reference_size, coding_size>::code_width, Code> >
+{
+    typedef LzssConstants<reference_size, coding_size>                                  constants;
+    typedef LzssTlm<LzssPacket<constants::data_width, Data>, LzssPacket<constants::code_width, Code> >    base_t;
+    typedef LzssEnc<reference_size, coding_size>                                        model_t;
+
+public:
+    LzssEncTlm(const sc_module_name& name, bool length_extension, const sc_time& cycle_time, size_t buffer_size = 1 << 22) :
+        base_t  (name, cycle_time, coding_size + 1, buffer_size, (buffer_size * constants::code_width + 7) / 8),
+        model   ("model", length_extension)
+    {
+        model.data_in_if(this->in_fifo);
+        model.code_out_if(this->out_fifo);
+    }
+
+    virtual void trace(sc_trace_file* tr) const {
+        model.trace(tr);
+    }
+
+protected:
+    model_t model;
+};
+
+/**
+ *  デコーダ
+ */
+template <int reference_size = 32, int coding_size = 9>
+class LzssDecTlm :
+    public  LzssTlm<LzssPacket<LzssConstants<reference_size, coding_size>::code_width, Code>, LzssPacket<LzssConstants<reference_size, coding_size>::data_width, Data> >
+{
+    typedef LzssConstants<reference_size, coding_size>                                  constants;
+    typedef LzssTlm<LzssPacket<constants::code_width, Code>, LzssPacket<constants::data_width, Data> >    base_t;
+    typedef LzssDec<reference_size, coding_size>                                        model_t;
+
+public:
+    LzssDecTlm(const sc_module_name& name, bool length_extension, const sc_time& cycle_time, size_t buffer_size = 1 << 22) :
+        base_t  (name, cycle_time, 1, (buffer_size * constants::code_width + 7) / 8, buffer_size),
+        model   ("model", length_extension)
+    {
+        model.code_in_if(this->in_fifo);
+        model.data_out_if(this->out_fifo);
+    }
+
+    virtual void trace(sc_trace_file* tr) const {
+        model.trace(tr);
+    }
+
+protected:
+    model_t model;
+};
+
+#endif /* LZSS_TLM_H_ */
@@ -16,6 +16,7 @@
 #include "systemc.h"
 #include "lzss_utility.h"
 #include "lzss_packet.h"
+#include "lzss_uint.h"
 
 using namespace sc_core;
 using namespace sc_dt;
@@ -27,21 +28,24 @@ struct LzssConstants {
     static const int    length_width    = Log2<coding_size - 1>::value;
     static const int    data_width      = 8;
     static const int    code_width      = offset_width + length_width + 1;
+    static const int    extension_width = code_width - 1;
+    static const unsigned int   extension_max   = (1u << extension_width) - 1;
 };
 
 #define LzssTypeDefine(r, c) \
-    typedef LzssConstants<r, c>                     constants;\
-    typedef sc_uint<constants::data_width>          data_t;\
-    typedef sc_uint<constants::code_width>          code_t;\
-    typedef LzssPacket<constants::data_width, Data> data_packet_t;\
-    typedef LzssPacket<constants::code_width, Code> code_packet_t;\
-    typedef sc_fifo_in_if<data_packet_t>            data_in_if_t;\
-    typedef sc_fifo_in_if<code_packet_t>            code_in_if_t;\
-    typedef sc_fifo_out_if<data_packet_t>           data_out_if_t;\
-    typedef sc_fifo_out_if<code_packet_t>           code_out_if_t;\
-    typedef sc_uint<1>                              flag_t;\
-    typedef sc_uint<constants::offset_width>        offset_t;\
-    typedef sc_uint<constants::length_width>        length_t;\
+    typedef LzssConstants<r, c>                                         constants;\
+    typedef typename LzssUint<constants::data_width>::type              data_t;\
+    typedef typename LzssUint<constants::code_width>::type              code_t;\
+    typedef LzssPacket<constants::data_width, Data>                     data_packet_t;\
+    typedef LzssPacket<constants::code_width, Code>                     code_packet_t;\
+    typedef sc_fifo_in_if<data_packet_t>                                data_in_if_t;\
+    typedef sc_fifo_in_if<code_packet_t>                                code_in_if_t;\
+    typedef sc_fifo_out_if<data_packet_t>                               data_out_if_t;\
+    typedef sc_fifo_out_if<code_packet_t>                               code_out_if_t;\
+    typedef typename LzssUint<1>::type                                  flag_t;\
+    typedef typename LzssUint<constants::offset_width>::type            offset_t;\
+    typedef typename LzssUint<constants::length_width>::type            length_t;\
+    typedef typename LzssUint<constants::extension_width>::type         extension_t;\
 
 
 #endif /* LZSS_TYPE_H_ */
@@ -0,0 +1,131 @@
+/**
+ *  @file   lzss_uint.h
+ *  @brief  モデル内部で使用する符号なし整数型
+ *
+ *  NATIVE_TYPEを定義した場合はsc_uint<W>の代わりに
+ *  ネイティブ整数(uint8_t/uint16_t/uint32_t/uint64_t)をビット幅でマスクするラッパを使用する。
+ *  モデル側で使用する演算(ビット選択/範囲選択/連接/比較)のみを提供する。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_UINT_H_
+#define LZSS_UINT_H_
+
+#include <iostream>
+#include <string>
+#include <stdint.h>
+#include "systemc.h"
+
+using namespace std;
+using namespace sc_core;
+using namespace sc_dt;
+
+/**
+ *  ビット幅を格納できる最小のネイティブ整数型
+ */
+template <int w, bool fit8 = (w <= 8), bool fit16 = (w <= 16), bool fit32 = (w <= 32)>
+struct NativeStorage {
+    typedef uint64_t    type;
+};
+
+template <int w>
+struct NativeStorage<w, true, true, true> {
+    typedef uint8_t     type;
+};
+
+template <int w>
+struct NativeStorage<w, false, true, true> {
+    typedef uint16_t    type;
+};
+
+template <int w>
+struct NativeStorage<w, false, false, true> {
+    typedef uint32_t    type;
+};
+
+template <int w>
+class NativeUint {
+public:
+    typedef typename NativeStorage<w>::type storage_t;
+
+    static const uint64_t   mask    = ((((uint64_t)1 << (w - 1)) << 1) - 1);
+
+    NativeUint() :
+        bits    (0)
+    {}
+
+    NativeUint(uint64_t value) :
+        bits    ((storage_t)(value & mask))
+    {}
+
+    NativeUint<w>& operator =(uint64_t value) {
+        bits    = (storage_t)(value & mask);
+        return *this;
+    }
+
+    operator uint64_t() const {
+        return bits;
+    }
+
+    bool operator [](int index) const {
+        return ((bits >> index) & 0x1) ? true : false;
+    }
+
+    uint64_t range(int high, int low) const {
+        return ((uint64_t)bits >> low) & ((((uint64_t)1 << (high - low)) << 1) - 1);
+    }
+
+    unsigned int to_uint() const {
+        return (unsigned int)bits;
+    }
+
+    uint64_t to_uint64() const {
+        return bits;
+    }
+
+    const storage_t& raw() const {
+        return bits;
+    }
+
+protected:
+    storage_t   bits;
+};
+
+/**
+ *  連接 : (a, b)は上位側がa
+ */
+template <int w1, int w2>
+NativeUint<w1 + w2> operator ,(const NativeUint<w1>& high, const NativeUint<w2>& low) {
+    return NativeUint<w1 + w2>((high.to_uint64() << w2) | low.to_uint64());
+}
+
+template <int w>
+void sc_trace(sc_trace_file* tr, const NativeUint<w>& val, const string& name) {
+    sc_trace(tr, val.raw(), name, w);
+}
+
+template <int w>
+ostream& operator <<(ostream& os, const NativeUint<w>& val) {
+    os << val.to_uint64();
+    return os;
+}
+
+/**
+ *  モデルで使用する符号なし整数型の選択
+ */
+template <int w>
+struct LzssUint {
+#ifdef NATIVE_TYPE
+    typedef NativeUint<w>   type;
+#else
+    typedef sc_uint<w>      type;
+#endif
+};
+
+#endif /* LZSS_UINT_H_ */
@@ -0,0 +1,122 @@
+/**
+ *  @file   array_main.cpp
+ *  @brief  エンコーダアレイ(lzss_enc_array_top)のRTLシミュレーションのメイン
+ *
+ *  usage : sim_array [-i input_dir] [-l list_file] [-s index/count] [stimulus ...]
+ *
+ *  全ファイルをSTREAMS個のストリームに分けて同時にエンコーダアレイへ入力し、
+ *  全体のバイト/サイクルとファイルごとの完了サイクルを表示する。
+ *  ビルドはsim/etc/build_array.shを参照。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef TIME_OUT
+#define TIME_OUT        40000000
+#endif
+
+#ifndef REFERENCE_SIZE
+#define REFERENCE_SIZE  64
+#endif
+
+#ifndef CODING_SIZE
+#define CODING_SIZE     5
+#endif
+
+#ifndef BYTES_PER_CYCLE
+#define BYTES_PER_CYCLE 1
+#endif
+
+#ifndef LANES
+#define LANES           4
+#endif
+
+#ifndef STREAMS
+#define STREAMS         8
+#endif
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "verilated.h"
+#include "cpp_stimulus.h"
+#include "cpp_array_top.h"
+
+using namespace std;
+
+typedef CppArrayTop<REFERENCE_SIZE, CODING_SIZE, LANES * BYTES_PER_CYCLE, LANES, STREAMS>   top_t;
+
+int main(int argc, char* argv[]) {
+    VerilatedContext*       context = new VerilatedContext;
+    top_t*                  top;
+    top_t::Summary          summary;
+    CppStimulus             stimulus;
+    vector<data_stream_t>   data_streams;
+    string                  file;
+    int                     fatal_count = 0;
+
+    context->commandArgs(argc, argv);
+    if (!stimulus.parse_arguments(argc, argv, true)) {
+        cout << "Usage : " << argv[0] << " [-i input_dir] [-l list_file] [-s index/count] [stimulus ...]" << endl;
+        return 1;
+    }
+
+    cout << "Reference Size : " << REFERENCE_SIZE   << endl;
+    cout << "Coding Size    : " << CODING_SIZE      << endl;
+    cout << "Bytes/Cycle    : " << BYTES_PER_CYCLE  << endl;
+    cout << "Lanes          : " << LANES            << endl;
+    cout << "Streams        : " << STREAMS          << endl;
+
+    data_streams.resize(stimulus.list.size());
+    for (size_t i = 0;i < stimulus.list.size();i++) {
+        file    = stimulus.data_in_dir + "/" + stimulus.list[i];
+        ifstream    ifs(file.c_str(), ios::binary);
+        if (!ifs) {
+            cout << "Fatal       : can not open " << file << endl;
+            return 1;
+        }
+        data_streams[i].assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+    }
+
+    top     = new top_t(context, TIME_OUT);
+    summary = top->run(data_streams);
+    if (summary.time_out) {
+        cout << "Fatal       : time out" << endl;
+        fatal_count += 1;
+    }
+
+    for (size_t i = 0;i < stimulus.list.size();i++) {
+        const top_t::Result&    result  = top->get_results()[i];
+        cout << "File        : " << stimulus.list[i]
+             << " stream "       << result.stream
+             << " input "        << result.data_size << "bytes"
+             << " code "         << result.code_size << "codes"
+             << " end "          << result.end_cycle << "cycles"
+             << " errors "       << result.errors    << endl;
+    }
+    delete  top;
+    delete  context;
+
+    cout << "------------------------------------------------"                     << endl;
+    cout << "Total Input      : " << summary.data_size << "bytes"                   << endl;
+    cout << "Total Code       : " << summary.code_size << "codes"                   << endl;
+    cout << "Total Cycles     : " << summary.cycles                                 << endl;
+    cout << "Input Stalls     : " << summary.input_stalls                           << endl;
+    cout << "Bytes/Cycle      : " << ((summary.cycles > 0) ? ((double)summary.data_size / summary.cycles) : 0.0) << endl;
+    cout << "Total Cycles/sec : " << ((summary.time > 0.0) ? (summary.cycles / summary.time) : 0.0) << endl;
+    cout << "------------------------------------------------"                     << endl;
+    cout << "Message Information"                                                   << endl;
+    cout << "Info  : " << stimulus.list.size()                                      << endl;
+    cout << "Error : " << summary.errors                                            << endl;
+    cout << "Fatal : " << fatal_count                                               << endl;
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ *  @file   axis_main.cpp
+ *  @brief  AXI4-Streamエンコーダ(lzss_enc_axis_top)のRTLシミュレーションのメイン
+ *
+ *  usage : sim_axis [-i input_dir] [-l list_file] [-s index/count] [-k] [-r] [stimulus ...]
+ *
+ *  全ファイルを連続するフレームとしてAXIS_BYTESバイトのビートで入力し、
+ *  入力のバイト/サイクル、出力のビート/サイクルとファイルごとの完了サイクルを表示する。
+ *  -kはTKEEPにヌルバイトを混ぜ(全バイトがヌルのTLASTのビートを含む)、-rは出力のTREADYを間欠的に落とす。
+ *  ビルドはsim/etc/build_axis.shを参照。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef TIME_OUT
+#define TIME_OUT        40000000
+#endif
+
+#ifndef REFERENCE_SIZE
+#define REFERENCE_SIZE  64
+#endif
+
+#ifndef CODING_SIZE
+#define CODING_SIZE     5
+#endif
+
+#ifndef BYTES_PER_CYCLE
+#define BYTES_PER_CYCLE 8
+#endif
+
+#ifndef AXIS_BYTES
+#define AXIS_BYTES      8
+#endif
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "verilated.h"
+#include "cpp_stimulus.h"
+#include "cpp_axis_top.h"
+
+using namespace std;
+
+typedef CppAxisTop<REFERENCE_SIZE, CODING_SIZE, AXIS_BYTES> top_t;
+
+int main(int argc, char* argv[]) {
+    VerilatedContext*       context = new VerilatedContext;
+    top_t*                  top;
+    top_t::Summary          summary;
+    CppStimulus             stimulus;
+    vector<data_stream_t>   data_streams;
+    string                  file;
+    bool                    sparse_keep;
+    bool                    stall_output;
+    int                     fatal_count     = 0;
+
+    context->commandArgs(argc, argv);
+    if (!stimulus.parse_arguments(argc, argv, true, "kr")) {
+        cout << "Usage : " << argv[0] << " [-i input_dir] [-l list_file] [-s index/count] [-k] [-r] [stimulus ...]" << endl;
+        return 1;
+    }
+    sparse_keep     = stimulus.has_flag('k');
+    stall_output    = stimulus.has_flag('r');
+
+    cout << "Reference Size : " << REFERENCE_SIZE               << endl;
+    cout << "Coding Size    : " << CODING_SIZE                  << endl;
+    cout << "Bytes/Cycle    : " << BYTES_PER_CYCLE              << endl;
+    cout << "AXIS Bytes     : " << AXIS_BYTES                   << endl;
+    cout << "Sparse TKEEP   : " << (sparse_keep  ? "on" : "off")<< endl;
+    cout << "Output Stall   : " << (stall_output ? "on" : "off")<< endl;
+
+    data_streams.resize(stimulus.list.size());
+    for (size_t i = 0;i < stimulus.list.size();i++) {
+        file    = stimulus.data_in_dir + "/" + stimulus.list[i];
+        ifstream    ifs(file.c_str(), ios::binary);
+        if (!ifs) {
+            cout << "Fatal       : can not open " << file << endl;
+            return 1;
+        }
+        data_streams[i].assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+    }
+
+    top     = new top_t(context, TIME_OUT, sparse_keep, stall_output);
+    summary = top->run(data_streams);
+    if (summary.time_out) {
+        cout << "Fatal       : time out" << endl;
+        fatal_count += 1;
+    }
+
+    for (size_t i = 0;i < stimulus.list.size();i++) {
+        const top_t::Result&    result  = top->get_results()[i];
+        cout << "File        : " << stimulus.list[i]
+             << " input "        << result.data_size   << "bytes"
+             << " code "         << result.code_size   << "codes"
+             << " packed "       << result.packed_size << "bytes"
+             << " end "          << result.end_cycle   << "cycles"
+             << " errors "       << result.errors      << endl;
+    }
+    delete  top;
+    delete  context;
+
+    cout << "------------------------------------------------"                     << endl;
+    cout << "Total Input      : " << summary.data_size   << "bytes"                 << endl;
+    cout << "Total Packed     : " << summary.packed_size << "bytes"                 << endl;
+    cout << "Total Cycles     : " << summary.cycles                                 << endl;
+    cout << "Input Beats      : " << summary.input_beats                            << endl;
+    cout << "Output Beats     : " << summary.output_beats                           << endl;
+    cout << "Input Stalls     : " << summary.input_stalls                           << endl;
+    cout << "Null TLAST Beats : " << summary.null_lasts                             << endl;
+    cout << "Bytes/Cycle      : " << ((summary.cycles > 0) ? ((double)summary.data_size    / summary.cycles) : 0.0) << endl;
+    cout << "Out Beats/Cycle  : " << ((summary.cycles > 0) ? ((double)summary.output_beats / summary.cycles) : 0.0) << endl;
+    cout << "Total Cycles/sec : " << ((summary.time > 0.0) ? (summary.cycles / summary.time) : 0.0) << endl;
+    cout << "------------------------------------------------"                     << endl;
+    cout << "Message Information"                                                   << endl;
+    cout << "Info  : " << stimulus.list.size()                                      << endl;
+    cout << "Error : " << summary.errors                                            << endl;
+    cout << "Fatal : " << fatal_count                                               << endl;
+
+    return 0;
+}
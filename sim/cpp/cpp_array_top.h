@@ -0,0 +1,321 @@
+/**
+ *  @file   cpp_array_top.h
+ *  @brief  エンコーダアレイ(lzss_enc_array_top)のRTLシミュレーション用トップ
+ *
+ *  Vdut_enc_arrayを直接eval()し、クロックも自前でトグルする(cpp_top.hと同様)。
+ *  ファイルをstreams個のストリームIDに順に割り当て、各ストリームのファイルを連続するフレームとして
+ *  ストリームごとにラウンドロビンで1ビートずつ入力する(異なるストリームのビートが混在する)。
+ *  入力途中のフレームはlanes個までとし、ストリームの次のフレームは前のフレームの出力完了後に入力する
+ *  (lzss_enc_array_top.vの入力の制約)。
+ *  出力はo_idのストリームの期待値コード(Lzss::encode)と比較する。
+ *  beat_sizeは入力ビートのバイト数/出力ビートのコード数(dut_enc_array.vのpBeatSize)。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef CPP_ARRAY_TOP_H_
+#define CPP_ARRAY_TOP_H_
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <stdint.h>
+#include <time.h>
+#include "verilated.h"
+#include "Vdut_enc_array.h"
+#include "lzss.h"
+#include "cpp_port.h"
+
+using namespace std;
+
+template <
+    int reference_size  = 64,
+    int coding_size     = 5,
+    int beat_size       = 4,
+    int lanes           = 4,
+    int streams         = 8
+>
+class CppArrayTop {
+    typedef Lzss<reference_size, coding_size>   model_t;
+    typedef typename model_t::code_t            model_code_t;
+
+    static const int    code_width  = model_t::code_width;
+
+    //  エラー表示の上限(全体)
+    static const int    max_message_num = 10;
+
+public:
+    //  ファイルごとの結果
+    struct Result {
+        int         stream;
+        uint64_t    data_size;
+        uint64_t    code_size;
+        uint64_t    end_cycle;
+        int         errors;
+    };
+
+    //  全体の結果
+    struct Summary {
+        uint64_t    data_size;
+        uint64_t    code_size;
+        uint64_t    cycles;
+        uint64_t    input_stalls;   //  i_valid & ~ow_ready
+        double      time;
+        bool        time_out;
+        int         errors;
+    };
+
+    CppArrayTop(VerilatedContext* context, uint64_t time_out, int reset_cycles = 4);
+    ~CppArrayTop();
+
+    Summary run(const vector<data_stream_t>& data_streams);
+
+    const vector<Result>& get_results() const {
+        return results;
+    }
+
+protected:
+    //  ストリーム内の1ファイル(1フレーム)
+    struct Frame {
+        int                     file;
+        const data_stream_t*    data;
+        vector<model_code_t>    codes;
+    };
+
+    VerilatedContext*       context;
+    Vdut_enc_array*         dut;
+    const uint64_t          time_out;
+
+    model_t                 model;
+    vector<Result>          results;
+    int                     message_count;
+
+    void reset(int cycles);
+    void clock_low();
+    void clock_high();
+    void compare(int stream, size_t position, uint32_t model_value, bool model_last, uint32_t dut_value, bool dut_last, int& errors);
+
+    static double now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+    }
+};
+
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::CppArrayTop(VerilatedContext* context, uint64_t time_out, int reset_cycles) :
+    context         (context),
+    dut             (new Vdut_enc_array(context, "dut_enc_array")),
+    time_out        (time_out),
+    message_count   (0)
+{
+    reset(reset_cycles);
+}
+
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::~CppArrayTop() {
+    dut->final();
+    delete  dut;
+}
+
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+void CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::reset(int cycles) {
+    dut->rst_x      = 0;
+    dut->i_valid    = 0;
+    dut->i_id       = 0;
+    dut->i_keep     = 0;
+    dut->i_last     = 0;
+    dut->i_ready    = 0;
+    for (int i = 0;i < cycles;i++) {
+        clock_low();
+        clock_high();
+    }
+    dut->rst_x  = 1;
+}
+
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+void CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::clock_low() {
+    dut->clk    = 0;
+    dut->eval();
+    context->timeInc(1);
+}
+
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+void CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::clock_high() {
+    dut->clk    = 1;
+    dut->eval();
+    context->timeInc(1);
+}
+
+/**
+ *  全ファイルをストリームに分けて同時に入力し、期待値と比較する
+ *  入力ビートはow_readyが返るまで保持する(別ストリームのビートに切り替えない)。
+ */
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+typename CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::Summary CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::run(const vector<data_stream_t>& data_streams) {
+    Summary         summary = {0, 0, 0, 0, 0.0, false, 0};
+    vector<Frame>   frames[streams];
+    size_t          in_frame[streams];
+    size_t          in_position[streams];
+    size_t          out_frame[streams];
+    size_t          out_position[streams];
+    int             remaining   = 0;
+    int             in_stream   = -1;
+    int             select;
+    int             open_frames;
+    int             in_size     = 0;
+    bool            in_last     = false;
+    int             id;
+    int             code_size;
+    uint32_t        code[beat_size];
+    bool            code_last;
+    bool            in_ack;
+    bool            out_ack;
+    double          start;
+
+    //  期待値
+    results.assign(data_streams.size(), Result());
+    for (size_t i = 0;i < data_streams.size();i++) {
+        Frame   frame;
+        frame.file  = i;
+        frame.data  = &data_streams[i];
+        if (data_streams[i].empty()) {
+            continue;
+        }
+        frame.codes.resize(data_streams[i].size());
+        frame.codes.resize(model.encode(&data_streams[i][0], data_streams[i].size(), &frame.codes[0]));
+        frames[i % streams].push_back(frame);
+        results[i].stream       = i % streams;
+        results[i].data_size    = data_streams[i].size();
+        results[i].code_size    = frame.codes.size();
+        summary.data_size      += data_streams[i].size();
+        summary.code_size      += frame.codes.size();
+        remaining              += 1;
+    }
+    for (int s = 0;s < streams;s++) {
+        in_frame[s]     = 0;
+        in_position[s]  = 0;
+        out_frame[s]    = 0;
+        out_position[s] = 0;
+    }
+
+    start   = now();
+    while (remaining > 0) {
+        //  入力ストリームの選択(前のビートが受け付けられた後、次のストリームから順に)
+        if (in_size == 0) {
+            open_frames = 0;
+            for (int s = 0;s < streams;s++) {
+                open_frames += (in_position[s] > 0) ? 1 : 0;
+            }
+            select  = -1;
+            for (int i = 1;(select < 0) && (i <= streams);i++) {
+                int s   = (in_stream + i + streams) % streams;
+                if ((in_frame[s] < frames[s].size()) &&
+                    ((in_position[s] > 0) || ((open_frames < lanes) && (out_frame[s] == in_frame[s])))) {
+                    select  = s;
+                }
+            }
+            if (select >= 0) {
+                in_stream   = select;
+                const data_stream_t&    data    = *frames[in_stream][in_frame[in_stream]].data;
+                uint64_t                keep    = 0;
+                while ((in_size < beat_size) && ((in_position[in_stream] + in_size) < data.size())) {
+                    keep    |= (uint64_t)1 << in_size;
+                    in_size += 1;
+                }
+                for (int i = 0;i < beat_size;i++) {
+                    set_port_bits(dut->i_data, i * 8, 8, (i < in_size) ? data[in_position[in_stream] + i] : 0);
+                }
+                dut->i_keep = keep;
+                in_last     = (in_position[in_stream] + in_size) == data.size();
+            }
+        }
+        dut->i_valid    = (in_size > 0) ? 1 : 0;
+        dut->i_id       = (in_size > 0) ? in_stream : 0;
+        dut->i_last     = (in_size > 0) ? in_last : false;
+        dut->i_ready    = 1;
+        clock_low();
+
+        //  ハンドシェイク判定(ow_readyは組み合わせ出力)
+        in_ack      = dut->i_valid && dut->ow_ready;
+        out_ack     = dut->o_valid && dut->i_ready;
+        id          = dut->o_id;
+        code_last   = dut->o_last;
+        code_size   = 0;
+        for (int i = 0;i < beat_size;i++) {
+            if (port_bits(dut->o_keep, i, 1)) {
+                code[code_size++]   = port_bits(dut->o_code, i * code_width, code_width);
+            }
+        }
+        if (dut->i_valid && (!dut->ow_ready)) {
+            summary.input_stalls    += 1;
+        }
+
+        clock_high();
+        summary.cycles  += 1;
+
+        if (in_ack) {
+            in_position[in_stream]  += in_size;
+            if (in_last) {
+                in_frame[in_stream]     += 1;
+                in_position[in_stream]   = 0;
+            }
+            in_size = 0;
+        }
+        if (out_ack && ((id >= streams) || (out_frame[id] >= frames[id].size()))) {
+            compare(id, 0, 0, false, (code_size > 0) ? code[0] : 0, code_last, summary.errors);
+        }
+        else if (out_ack) {
+            Frame&  frame   = frames[id][out_frame[id]];
+            for (int i = 0;i < code_size;i++) {
+                //  ラストはビートの最後のコードに付く
+                if (out_position[id] < frame.codes.size()) {
+                    compare(id, out_position[id], frame.codes[out_position[id]], (out_position[id] == (frame.codes.size() - 1)), code[i], code_last && (i == (code_size - 1)), results[frame.file].errors);
+                }
+                else {
+                    compare(id, out_position[id], 0, true, code[i], code_last && (i == (code_size - 1)), results[frame.file].errors);
+                }
+                out_position[id]    += 1;
+            }
+            if (code_last) {
+                if (out_position[id] != frame.codes.size()) {
+                    compare(id, out_position[id], 0, true, 0, false, results[frame.file].errors);
+                }
+                results[frame.file].end_cycle   = summary.cycles;
+                summary.errors                 += results[frame.file].errors;
+                out_frame[id]                  += 1;
+                out_position[id]                = 0;
+                remaining                      -= 1;
+            }
+        }
+
+        if (summary.cycles >= time_out) {
+            summary.time_out    = true;
+            break;
+        }
+    }
+    summary.time    = now() - start;
+
+    return summary;
+}
+
+template <int reference_size, int coding_size, int beat_size, int lanes, int streams>
+void CppArrayTop<reference_size, coding_size, beat_size, lanes, streams>::compare(int stream, size_t position, uint32_t model_value, bool model_last, uint32_t dut_value, bool dut_last, int& errors) {
+    if ((model_value == dut_value) && (model_last == dut_last)) {
+        return;
+    }
+    if (message_count < max_message_num) {
+        cout << "Error       : stream " << stream << " code[" << position << "]"
+             << " model " << hex << model_value << (model_last ? "(last)" : "")
+             << " dut "          << dut_value   << (dut_last   ? "(last)" : "") << dec << endl;
+        message_count   += 1;
+    }
+    errors  += 1;
+}
+
+#endif /* CPP_ARRAY_TOP_H_ */
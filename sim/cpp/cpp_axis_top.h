@@ -0,0 +1,340 @@
+/**
+ *  @file   cpp_axis_top.h
+ *  @brief  AXI4-Streamエンコーダ(lzss_enc_axis_top)のRTLシミュレーション用トップ
+ *
+ *  Vdut_enc_axisを直接eval()し、クロックも自前でトグルする(cpp_top.hと同様)。
+ *  ファイルを1フレームとしてaxis_bytesバイトのビートで連続して入力し、
+ *  出力ビートのバイトを期待値コード(Lzss::encode)を下位ビットから詰めたビット列と比較する。
+ *  sparse_keepの場合はTKEEPにヌルバイトを混ぜ、およそ半数のフレームは全バイトがヌルのTLASTのビートで終える。
+ *  stall_outputの場合はTREADYを間欠的に落とす(いずれも固定シードの擬似乱数で、結果は再現する)。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef CPP_AXIS_TOP_H_
+#define CPP_AXIS_TOP_H_
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <stdint.h>
+#include <time.h>
+#include "verilated.h"
+#include "Vdut_enc_axis.h"
+#include "lzss.h"
+#include "cpp_port.h"
+
+using namespace std;
+
+template <
+    int reference_size  = 64,
+    int coding_size     = 5,
+    int axis_bytes      = 8
+>
+class CppAxisTop {
+    typedef Lzss<reference_size, coding_size>   model_t;
+    typedef typename model_t::code_t            model_code_t;
+
+    static const int    code_width  = model_t::code_width;
+
+    //  エラー表示の上限(全体)
+    static const int    max_message_num = 10;
+
+public:
+    //  ファイルごとの結果
+    struct Result {
+        uint64_t    data_size;
+        uint64_t    code_size;      //  コード数
+        uint64_t    packed_size;    //  詰めたコードのバイト数
+        uint64_t    end_cycle;
+        int         errors;
+    };
+
+    //  全体の結果
+    struct Summary {
+        uint64_t    data_size;
+        uint64_t    packed_size;
+        uint64_t    cycles;
+        uint64_t    input_beats;
+        uint64_t    output_beats;
+        uint64_t    input_stalls;   //  TVALID & ~TREADY(入力側)
+        uint64_t    null_lasts;     //  全バイトがヌルのTLASTのビート
+        double      time;
+        bool        time_out;
+        int         errors;
+    };
+
+    CppAxisTop(VerilatedContext* context, uint64_t time_out, bool sparse_keep = false, bool stall_output = false, int reset_cycles = 4);
+    ~CppAxisTop();
+
+    Summary run(const vector<data_stream_t>& data_streams);
+
+    const vector<Result>& get_results() const {
+        return results;
+    }
+
+protected:
+    VerilatedContext*       context;
+    Vdut_enc_axis*          dut;
+    const uint64_t          time_out;
+    const bool              sparse_keep;
+    const bool              stall_output;
+
+    model_t                 model;
+    vector<Result>          results;
+    int                     message_count;
+    uint32_t                random_state;
+
+    void reset(int cycles);
+    void clock_low();
+    void clock_high();
+    uint32_t random();
+    void pack(const vector<model_code_t>& codes, vector<uint8_t>& packed);
+    void compare(int file, size_t position, uint32_t model_value, bool model_last, uint32_t dut_value, bool dut_last, int& errors);
+
+    static double now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+    }
+};
+
+template <int reference_size, int coding_size, int axis_bytes>
+CppAxisTop<reference_size, coding_size, axis_bytes>::CppAxisTop(VerilatedContext* context, uint64_t time_out, bool sparse_keep, bool stall_output, int reset_cycles) :
+    context         (context),
+    dut             (new Vdut_enc_axis(context, "dut_enc_axis")),
+    time_out        (time_out),
+    sparse_keep     (sparse_keep),
+    stall_output    (stall_output),
+    message_count   (0),
+    random_state    (0x12345678)
+{
+    reset(reset_cycles);
+}
+
+template <int reference_size, int coding_size, int axis_bytes>
+CppAxisTop<reference_size, coding_size, axis_bytes>::~CppAxisTop() {
+    dut->final();
+    delete  dut;
+}
+
+template <int reference_size, int coding_size, int axis_bytes>
+void CppAxisTop<reference_size, coding_size, axis_bytes>::reset(int cycles) {
+    dut->rst_x      = 0;
+    dut->i_s_tvalid = 0;
+    dut->i_s_tkeep  = 0;
+    dut->i_s_tlast  = 0;
+    dut->i_m_tready = 0;
+    for (int i = 0;i < cycles;i++) {
+        clock_low();
+        clock_high();
+    }
+    dut->rst_x  = 1;
+}
+
+template <int reference_size, int coding_size, int axis_bytes>
+void CppAxisTop<reference_size, coding_size, axis_bytes>::clock_low() {
+    dut->clk    = 0;
+    dut->eval();
+    context->timeInc(1);
+}
+
+template <int reference_size, int coding_size, int axis_bytes>
+void CppAxisTop<reference_size, coding_size, axis_bytes>::clock_high() {
+    dut->clk    = 1;
+    dut->eval();
+    context->timeInc(1);
+}
+
+/**
+ *  擬似乱数(xorshift32)
+ */
+template <int reference_size, int coding_size, int axis_bytes>
+uint32_t CppAxisTop<reference_size, coding_size, axis_bytes>::random() {
+    random_state   ^= random_state << 13;
+    random_state   ^= random_state >> 17;
+    random_state   ^= random_state << 5;
+    return random_state;
+}
+
+/**
+ *  コードを下位ビットから詰めたバイト列にする(lzss_axis_out.vと同じ並び)
+ */
+template <int reference_size, int coding_size, int axis_bytes>
+void CppAxisTop<reference_size, coding_size, axis_bytes>::pack(const vector<model_code_t>& codes, vector<uint8_t>& packed) {
+    uint64_t    bits    = 0;
+    int         count   = 0;
+
+    packed.clear();
+    for (size_t i = 0;i < codes.size();i++) {
+        bits   |= (uint64_t)codes[i] << count;
+        count  += code_width;
+        while (count >= 8) {
+            packed.push_back((uint8_t)bits);
+            bits  >>= 8;
+            count  -= 8;
+        }
+    }
+    if (count > 0) {
+        packed.push_back((uint8_t)bits);
+    }
+}
+
+/**
+ *  全ファイルを連続するフレームとして入力し、期待値と比較する
+ */
+template <int reference_size, int coding_size, int axis_bytes>
+typename CppAxisTop<reference_size, coding_size, axis_bytes>::Summary CppAxisTop<reference_size, coding_size, axis_bytes>::run(const vector<data_stream_t>& data_streams) {
+    Summary                 summary = {0, 0, 0, 0, 0, 0, 0, 0.0, false, 0};
+    vector<vector<uint8_t> > expected(data_streams.size());
+    vector<int>             files;
+    size_t                  in_frame        = 0;
+    size_t                  in_position     = 0;
+    size_t                  out_frame       = 0;
+    size_t                  out_position    = 0;
+    bool                    in_beat         = false;
+    int                     in_size         = 0;
+    bool                    in_last         = false;
+    uint32_t                out_data[axis_bytes];
+    int                     out_size;
+    bool                    out_keep_error;
+    bool                    out_last;
+    bool                    in_ack;
+    bool                    out_ack;
+    double                  start;
+
+    //  期待値(空のファイルはフレームにできないため入力しない)
+    results.assign(data_streams.size(), Result());
+    for (size_t i = 0;i < data_streams.size();i++) {
+        vector<model_code_t>    codes;
+        if (data_streams[i].empty()) {
+            continue;
+        }
+        codes.resize(data_streams[i].size());
+        codes.resize(model.encode(&data_streams[i][0], data_streams[i].size(), &codes[0]));
+        pack(codes, expected[i]);
+        files.push_back(i);
+        results[i].data_size    = data_streams[i].size();
+        results[i].code_size    = codes.size();
+        results[i].packed_size  = expected[i].size();
+        summary.data_size      += data_streams[i].size();
+        summary.packed_size    += expected[i].size();
+    }
+
+    start   = now();
+    while (out_frame < files.size()) {
+        //  入力ビート(前のビートが受け付けられるまで保持する)
+        if ((!in_beat) && (in_frame < files.size())) {
+            const data_stream_t&    data    = data_streams[files[in_frame]];
+            uint64_t                keep    = 0;
+            in_size = 0;
+            for (int i = 0;i < axis_bytes;i++) {
+                bool    valid   = (in_position + in_size) < data.size();
+                if (valid && sparse_keep) {
+                    valid   = (random() % 4) != 0;
+                }
+                keep   |= (uint64_t)(valid ? 1 : 0) << i;
+                set_port_bits(dut->i_s_tdata, i * 8, 8, valid ? data[in_position + in_size] : 0);
+                in_size    += valid ? 1 : 0;
+            }
+            dut->i_s_tkeep  = keep;
+            in_last         = (in_position + in_size) == data.size();
+            //  最後のバイトのビートにはTLASTを付けず、次の全バイトがヌルのビートで終える
+            if (in_last && sparse_keep && (in_size > 0) && ((random() % 2) == 0)) {
+                in_last = false;
+            }
+            in_beat         = true;
+        }
+        dut->i_s_tvalid = in_beat ? 1 : 0;
+        dut->i_s_tlast  = in_beat ? in_last : false;
+        dut->i_m_tready = (stall_output) ? (((random() % 4) != 0) ? 1 : 0) : 1;
+        clock_low();
+
+        //  ハンドシェイク判定(TREADYは組み合わせ出力)
+        in_ack          = dut->i_s_tvalid && dut->ow_s_tready;
+        out_ack         = dut->o_m_tvalid && dut->i_m_tready;
+        out_last        = dut->o_m_tlast;
+        out_size        = 0;
+        out_keep_error  = false;
+        for (int i = 0;i < axis_bytes;i++) {
+            if (port_bits(dut->o_m_tkeep, i, 1)) {
+                out_keep_error         |= (out_size != i);
+                out_data[out_size++]    = port_bits(dut->o_m_tdata, i * 8, 8);
+            }
+        }
+        if (dut->i_s_tvalid && (!dut->ow_s_tready)) {
+            summary.input_stalls    += 1;
+        }
+
+        clock_high();
+        summary.cycles  += 1;
+
+        if (in_ack) {
+            summary.input_beats    += 1;
+            summary.null_lasts     += (in_last && (in_size == 0)) ? 1 : 0;
+            in_position            += in_size;
+            if (in_last) {
+                in_frame       += 1;
+                in_position     = 0;
+            }
+            in_beat = false;
+        }
+        if (out_ack) {
+            int                     file    = files[out_frame];
+            const vector<uint8_t>&  packed  = expected[file];
+            summary.output_beats   += 1;
+
+            //  ラスト以外のビートは全バイト有効、TKEEPは下位から連続
+            if (out_keep_error || ((!out_last) && (out_size != axis_bytes))) {
+                compare(file, out_position, axis_bytes, false, out_size, out_last, results[file].errors);
+            }
+            for (int i = 0;i < out_size;i++) {
+                if (out_position < packed.size()) {
+                    compare(file, out_position, packed[out_position], (out_position == (packed.size() - 1)), out_data[i], out_last && (i == (out_size - 1)), results[file].errors);
+                }
+                else {
+                    compare(file, out_position, 0, true, out_data[i], out_last && (i == (out_size - 1)), results[file].errors);
+                }
+                out_position   += 1;
+            }
+            if (out_last) {
+                if (out_position != packed.size()) {
+                    compare(file, out_position, 0, true, 0, false, results[file].errors);
+                }
+                results[file].end_cycle = summary.cycles;
+                summary.errors         += results[file].errors;
+                out_frame              += 1;
+                out_position            = 0;
+            }
+        }
+
+        if (summary.cycles >= time_out) {
+            summary.time_out    = true;
+            break;
+        }
+    }
+    summary.time    = now() - start;
+
+    return summary;
+}
+
+template <int reference_size, int coding_size, int axis_bytes>
+void CppAxisTop<reference_size, coding_size, axis_bytes>::compare(int file, size_t position, uint32_t model_value, bool model_last, uint32_t dut_value, bool dut_last, int& errors) {
+    if ((model_value == dut_value) && (model_last == dut_last)) {
+        return;
+    }
+    if (message_count < max_message_num) {
+        cout << "Error       : file " << file << " byte[" << position << "]"
+             << " model " << hex << model_value << (model_last ? "(last)" : "")
+             << " dut "          << dut_value   << (dut_last   ? "(last)" : "") << dec << endl;
+        message_count   += 1;
+    }
+    errors  += 1;
+}
+
+#endif /* CPP_AXIS_TOP_H_ */
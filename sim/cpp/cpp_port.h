@@ -0,0 +1,57 @@
+/**
+ *  @file   cpp_port.h
+ *  @brief  Verilatorのポートのビット操作(cpp_top.h/cpp_array_top.hで共通)
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef CPP_PORT_H_
+#define CPP_PORT_H_
+
+#include <stdint.h>
+#include "verilated.h"
+
+/**
+ *  ポートの指定ビットを取り出す(Verilatorのポート型ごと)
+ */
+template <typename T>
+inline uint32_t port_bits(const T& port, int low, int width) {
+    return (uint32_t)(((uint64_t)port >> low) & (((uint64_t)1 << width) - 1));
+}
+
+template <std::size_t words>
+inline uint32_t port_bits(const VlWide<words>& port, int low, int width) {
+    uint64_t    value   = port[low / 32];
+    if (((low / 32) + 1) < (int)words) {
+        value   |= (uint64_t)port[(low / 32) + 1] << 32;
+    }
+    return (uint32_t)((value >> (low % 32)) & (((uint64_t)1 << width) - 1));
+}
+
+/**
+ *  ポートの指定ビットに値を設定する(Verilatorのポート型ごと)
+ */
+template <typename T>
+inline void set_port_bits(T& port, int low, int width, uint32_t value) {
+    uint64_t    mask    = (((uint64_t)1 << width) - 1) << low;
+    port    = (T)(((uint64_t)port & (~mask)) | (((uint64_t)value << low) & mask));
+}
+
+template <std::size_t words>
+inline void set_port_bits(VlWide<words>& port, int low, int width, uint32_t value) {
+    for (int i = 0;i < width;i++) {
+        if ((value >> i) & 0x1) {
+            port[(low + i) / 32]    |=  ((uint32_t)1 << ((low + i) % 32));
+        }
+        else {
+            port[(low + i) / 32]    &= ~((uint32_t)1 << ((low + i) % 32));
+        }
+    }
+}
+
+#endif /* CPP_PORT_H_ */
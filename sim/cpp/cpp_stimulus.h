@@ -0,0 +1,89 @@
+/**
+ *  @file   cpp_stimulus.h
+ *  @brief  SystemCを使用しないRTLシミュレーションのスティミュラス(main.cpp/array_main.cpp/axis_main.cppで共通)
+ *
+ *  実行時引数とリストファイルの解析はsc_model/etc/lzss_stimulus.hのStimulusList
+ *  (sc_model/etc/lzss_utility.hのStimulusと共通)で、ここでは既定のリストのみを持つ。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     引数の解析をlzss_stimulus.hに移動
+ */
+
+#ifndef CPP_STIMULUS_H_
+#define CPP_STIMULUS_H_
+
+#include <string>
+#include "lzss_stimulus.h"
+
+using namespace std;
+
+struct CppStimulus :
+    public  StimulusList
+{
+    CppStimulus() {
+        data_in_dir = "../sample";
+    }
+
+    /**
+     *  実行時引数からスティミュラスを設定する
+     *  スティミュラスの指定がない場合は既定のリストを使用し、シャード分割を適用する。
+     *  @return 引数が不正な場合false
+     */
+    bool parse_arguments(int argc, const char* const* argv, bool full_default = false, const string& flag_options = "") {
+        if (!StimulusList::parse_arguments(argc, argv, flag_options)) {
+            return false;
+        }
+
+        if (list.empty()) {
+            if (full_default) {
+                add_full_list();
+            }
+            else {
+                add_default_list();
+            }
+        }
+        apply_shard();
+
+        return true;
+    }
+
+    //  サンプルの全ファイル
+    void add_full_list() {
+        list.push_back("alice29.txt");
+        list.push_back("cp.html");
+        list.push_back("grammar.lsp");
+        list.push_back("lcet10.txt");
+        list.push_back("ptt5");
+        list.push_back("asyoulik.txt");
+        list.push_back("kennedy.xls");
+        list.push_back("plrabn12.txt");
+        list.push_back("sum");
+        list.push_back("xargs.1");
+        list.push_back("test1.txt");
+        list.push_back("test2.txt");
+        list.push_back("test3.txt");
+    }
+
+    //  既定のリスト(SIMPLE_STIMULUSES/FULL_STIMULUSESで切り替え)
+    void add_default_list() {
+#if defined SIMPLE_STIMULUSES
+        list.push_back("test1.txt");
+        list.push_back("test2.txt");
+        list.push_back("test3.txt");
+#elif defined FULL_STIMULUSES
+        add_full_list();
+#else
+        list.push_back("alice29.txt");
+        list.push_back("test3.txt");
+        list.push_back("test2.txt");
+        list.push_back("test1.txt");
+#endif
+    }
+};
+
+#endif /* CPP_STIMULUS_H_ */
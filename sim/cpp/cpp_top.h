@@ -0,0 +1,485 @@
+/**
+ *  @file   cpp_top.h
+ *  @brief  SystemCカーネルを使用しないRTLシミュレーション用トップ
+ *
+ *  Vdut_enc/Vdut_decを直接eval()し、クロックも自前でトグルする。
+ *  期待値はCモデル(Lzss::encode)でファイルごとに一括生成し
+ *  (SystemCモデルLzssEncとの一致はsc_model/etc/model_check.cppで確認する)、
+ *  エンコーダには入力データ配列、デコーダには期待値コード配列をそのまま入力する
+ *  (sim/env/env.hと同様にデコーダへはモデルのコードを入力する)。
+ *  エンコーダの出力は期待値コード、デコーダの出力は入力データと比較する。
+ *  スループットはsim/env/lzss_dut_throughput.hで集計する。
+ *  bytes_per_cycleはエンコーダの1ビートのバイト数(dut_enc.vのdBytesPerCycle)。
+ *  decoder_bytes_per_cycleはデコーダの1ビートの最大バイト数(dut_dec.vのdDecoderBytesPerCycle)。
+ *  model_typeは期待値を生成するエンコーダのCモデル(lzss_enc_hash_topはLzssHash)。
+ *  modelはDUTの構成に合わせたCモデル(lzss_enc_topのpEarlyLiteralsはLzssのearly_literals)。
+ *  エンコーダのレイテンシは最初の入力から最初のコード、最後の入力から最後のコードまでのサイクル数。
+ *  性能カウンタ(rtl/lzss_perf_counter.v)はDUTのAPBポートから読み出す(dPerfCounter = 0の場合はenable = false)。
+ *  run(frames)は複数のフレームを間を空けずに連続して入力し、フレームごとの期待値と比較する。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     フレームの連続入力(run(frames))を追加
+ */
+
+#ifndef CPP_TOP_H_
+#define CPP_TOP_H_
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <stdint.h>
+#include <time.h>
+#include "verilated.h"
+#include "Vdut_enc.h"
+#include "Vdut_dec.h"
+#include "lzss.h"
+#include "lzss_hash.h"
+#include "lzss_dut_throughput.h"
+#include "cpp_port.h"
+
+using namespace std;
+
+template <
+    int reference_size  = 32,
+    int coding_size     = 9,
+    int bytes_per_cycle = 1,
+    int decoder_bytes_per_cycle = 1,
+    typename model_type = Lzss<reference_size, coding_size>
+>
+class CppTop {
+    typedef model_type                          model_t;
+    typedef typename model_t::code_t            model_code_t;
+
+    static const int    code_width  = model_t::code_width;
+
+    //  エラー表示の上限(ファイルごと)
+    static const int    max_message_num = 10;
+
+public:
+    //  ファイルごとの結果
+    struct Result {
+        uint64_t    data_size;
+        uint64_t    code_size;
+        uint64_t    cycles;
+        uint64_t    first_code_latency;
+        uint64_t    last_code_latency;
+        double      time;
+        bool        time_out;
+        int         errors;
+    };
+
+    //  性能カウンタ
+    struct PerfCounter {
+        bool                enable;
+        uint64_t            cycles;
+        uint64_t            data_count;
+        uint64_t            code_count;
+        uint64_t            match_count;
+        uint64_t            literal_count;
+        uint64_t            data_stalls;
+        uint64_t            code_stalls;
+        vector<uint64_t>    histogram;      //  一致長2から(最後は最大ビン以上)
+    };
+
+    CppTop(VerilatedContext* context, uint64_t time_out, const model_t& model = model_t(), int reset_cycles = 4);
+    ~CppTop();
+
+    Result run(const data_stream_t& data_stream);
+    Result run(const vector<data_stream_t>& frames);
+
+    void        clear_perf_counters();
+    PerfCounter get_enc_perf_counter();
+    PerfCounter get_dec_perf_counter();
+
+    const DutThroughput& get_enc_throughput() const {
+        return enc_throughput;
+    }
+
+    const DutThroughput& get_dec_throughput() const {
+        return dec_throughput;
+    }
+
+protected:
+    VerilatedContext*       context;
+    Vdut_enc*               dut_enc;
+    Vdut_dec*               dut_dec;
+    const uint64_t          time_out;
+
+    model_t                 model;
+    vector<model_code_t>    code_stream;
+
+    DutThroughput           enc_throughput;
+    DutThroughput           dec_throughput;
+
+    void reset(int cycles);
+    void clock_low();
+    void clock_high();
+    void compare(const char* id, size_t frame, size_t position, uint32_t model_value, bool model_last, uint32_t dut_value, bool dut_last, Result& result) const;
+
+    template <typename dut_t>
+    uint32_t    access_register(dut_t* dut, bool write, uint32_t address, uint32_t data = 0);
+    template <typename dut_t>
+    PerfCounter read_perf_counter(dut_t* dut);
+
+    static double now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+    }
+};
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::CppTop(VerilatedContext* context, uint64_t time_out, const model_t& model, int reset_cycles) :
+    context         (context),
+    dut_enc         (new Vdut_enc(context, "dut_enc")),
+    dut_dec         (new Vdut_dec(context, "dut_dec")),
+    time_out        (time_out),
+    model           (model),
+    enc_throughput  (true),
+    dec_throughput  (false)
+{
+    reset(reset_cycles);
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::~CppTop() {
+    dut_enc->final();
+    dut_dec->final();
+    delete  dut_enc;
+    delete  dut_dec;
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+void CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::reset(int cycles) {
+    dut_enc->rst_x      = 0;
+    dut_enc->i_valid    = 0;
+    dut_enc->i_data     = 0;
+    dut_enc->i_keep     = 0;
+    dut_enc->i_last     = 0;
+    dut_enc->i_ready    = 0;
+    dut_enc->i_psel     = 0;
+    dut_enc->i_penable  = 0;
+    dut_enc->i_pwrite   = 0;
+    dut_enc->i_paddr    = 0;
+    dut_enc->i_pwdata   = 0;
+    dut_dec->rst_x      = 0;
+    dut_dec->i_valid    = 0;
+    dut_dec->i_code     = 0;
+    dut_dec->i_last     = 0;
+    dut_dec->i_ready    = 0;
+    dut_dec->i_psel     = 0;
+    dut_dec->i_penable  = 0;
+    dut_dec->i_pwrite   = 0;
+    dut_dec->i_paddr    = 0;
+    dut_dec->i_pwdata   = 0;
+    for (int i = 0;i < cycles;i++) {
+        clock_low();
+        clock_high();
+    }
+    dut_enc->rst_x  = 1;
+    dut_dec->rst_x  = 1;
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+void CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::clock_low() {
+    dut_enc->clk    = 0;
+    dut_dec->clk    = 0;
+    dut_enc->eval();
+    dut_dec->eval();
+    context->timeInc(1);
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+void CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::clock_high() {
+    dut_enc->clk    = 1;
+    dut_dec->clk    = 1;
+    dut_enc->eval();
+    dut_dec->eval();
+    context->timeInc(1);
+}
+
+/**
+ *  1ファイル分をエンコーダ/デコーダに通して期待値と比較する
+ */
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+typename CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::Result CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::run(const data_stream_t& data_stream) {
+    return run(vector<data_stream_t>(1, data_stream));
+}
+
+/**
+ *  フレームを間を空けずに連続してエンコーダ/デコーダに通し、フレームごとの期待値と比較する
+ *  フレームの最後のビートにi_lastを付け、次のフレームは次のビートの下位レーンから始める。
+ *  期待値はフレームごとにCモデルで生成する(空のフレームは除く)。
+ *  ハンドシェイクはクロック立ち下がり側でeval()した後の
+ *  valid/readyで判定し、立ち上がりで成立したものとして扱う。
+ */
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+typename CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::Result CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::run(const vector<data_stream_t>& frames) {
+    Result          result              = {0, 0, 0, 0, 0, 0.0, false, 0};
+    data_stream_t   data_stream;
+    vector<size_t>  data_ends;
+    vector<size_t>  code_ends;
+    size_t          enc_in_position     = 0;
+    size_t          enc_in_frame        = 0;
+    size_t          enc_out_position    = 0;
+    size_t          enc_out_frame       = 0;
+    size_t          enc_last_count      = 0;
+    size_t          dec_in_position     = 0;
+    size_t          dec_in_frame        = 0;
+    size_t          dec_out_position    = 0;
+    size_t          dec_out_frame       = 0;
+    size_t          dec_last_count      = 0;
+    bool            enc_in_ack;
+    bool            enc_out_ack;
+    bool            dec_in_ack;
+    bool            dec_out_ack;
+    uint64_t        in_data;
+    uint32_t        in_keep;
+    int             in_size;
+    uint32_t        code[bytes_per_cycle];
+    int             code_size;
+    bool            code_last;
+    uint32_t        data[decoder_bytes_per_cycle];
+    int             data_size;
+    bool            data_last;
+    uint64_t        first_in_cycle      = 0;
+    uint64_t        last_in_cycle       = 0;
+    bool            code_started        = false;
+    double          start;
+
+    //  入力データと期待値(フレームの終端位置を保持する)
+    code_stream.clear();
+    for (size_t i = 0;i < frames.size();i++) {
+        if (frames[i].empty()) {
+            continue;
+        }
+        size_t  code_position   = code_stream.size();
+        data_stream.insert(data_stream.end(), frames[i].begin(), frames[i].end());
+        code_stream.resize(code_position + frames[i].size());
+        code_stream.resize(code_position + model.encode(&frames[i][0], frames[i].size(), &code_stream[code_position]));
+        data_ends.push_back(data_stream.size());
+        code_ends.push_back(code_stream.size());
+    }
+    result.data_size    = data_stream.size();
+    result.code_size    = code_stream.size();
+    if (data_ends.empty()) {
+        return result;
+    }
+
+    start   = now();
+    while ((enc_last_count < data_ends.size()) || (dec_last_count < data_ends.size())) {
+        //  入力セット(下位レーンから詰める、フレームをまたがない)
+        in_data = 0;
+        in_keep = 0;
+        in_size = 0;
+        while ((enc_in_frame < data_ends.size()) && (in_size < bytes_per_cycle) && ((enc_in_position + in_size) < data_ends[enc_in_frame])) {
+            in_data |= (uint64_t)data_stream[enc_in_position + in_size] << (8 * in_size);
+            in_keep |= 1 << in_size;
+            in_size += 1;
+        }
+        dut_enc->i_valid    = (in_size > 0) ? 1 : 0;
+        dut_enc->i_data     = in_data;
+        dut_enc->i_keep     = in_keep;
+        dut_enc->i_last     = ((in_size > 0) && ((enc_in_position + in_size) == data_ends[enc_in_frame])) ? 1 : 0;
+        dut_enc->i_ready    = 1;
+        dut_dec->i_valid    = (dec_in_position < code_stream.size()) ? 1 : 0;
+        dut_dec->i_code     = (dut_dec->i_valid) ? code_stream[dec_in_position] : 0;
+        dut_dec->i_last     = ((dut_dec->i_valid) && (dec_in_position == (code_ends[dec_in_frame] - 1))) ? 1 : 0;
+        dut_dec->i_ready    = 1;
+        clock_low();
+
+        //  ハンドシェイク判定(ow_readyは組み合わせ出力)
+        enc_in_ack  = dut_enc->i_valid && dut_enc->ow_ready;
+        enc_out_ack = dut_enc->o_valid && dut_enc->i_ready;
+        dec_in_ack  = dut_dec->i_valid && dut_dec->ow_ready;
+        dec_out_ack = dut_dec->o_valid && dut_dec->i_ready;
+        code_size   = 0;
+        for (int i = 0;i < bytes_per_cycle;i++) {
+            if ((dut_enc->o_keep >> i) & 0x1) {
+                code[code_size++]   = port_bits(dut_enc->o_code, i * code_width, code_width);
+            }
+        }
+        code_last   = dut_enc->o_last;
+        data_size   = 0;
+        for (int i = 0;i < decoder_bytes_per_cycle;i++) {
+            if ((dut_dec->o_keep >> i) & 0x1) {
+                data[data_size++]   = port_bits(dut_dec->o_data, i * 8, 8);
+            }
+        }
+        data_last   = dut_dec->o_last;
+        enc_throughput.sample(dut_enc->i_valid, dut_enc->ow_ready, dut_enc->i_last, dut_enc->o_valid, dut_enc->i_ready, code_last, in_size, code_size);
+        dec_throughput.sample(dut_dec->i_valid, dut_dec->ow_ready, dut_dec->i_last, dut_dec->o_valid, dut_dec->i_ready, data_last, 1, data_size);
+
+        clock_high();
+        result.cycles   += 1;
+
+        if (enc_in_ack) {
+            if (enc_in_position == 0) {
+                first_in_cycle  = result.cycles;
+            }
+            enc_in_position += in_size;
+            if (enc_in_position == data_ends[enc_in_frame]) {
+                enc_in_frame   += 1;
+                last_in_cycle   = result.cycles;
+            }
+        }
+        if (dec_in_ack) {
+            dec_in_position += 1;
+            if (dec_in_position == code_ends[dec_in_frame]) {
+                dec_in_frame   += 1;
+            }
+        }
+        for (int i = 0;enc_out_ack && (i < code_size);i++) {
+            //  ラストはビートの最後のコードに付く
+            while ((enc_out_frame < code_ends.size()) && (enc_out_position >= code_ends[enc_out_frame])) {
+                enc_out_frame  += 1;
+            }
+            if (enc_out_position < code_stream.size()) {
+                compare("code", enc_out_frame, enc_out_position, code_stream[enc_out_position], (enc_out_position == (code_ends[enc_out_frame] - 1)), code[i], code_last && (i == (code_size - 1)), result);
+            }
+            else {
+                compare("code", enc_out_frame, enc_out_position, 0, true, code[i], code_last && (i == (code_size - 1)), result);
+            }
+            enc_out_position    += 1;
+        }
+        if (enc_out_ack && (!code_started)) {
+            result.first_code_latency   = result.cycles - first_in_cycle;
+            code_started                = true;
+        }
+        if (enc_out_ack && code_last) {
+            result.last_code_latency    = result.cycles - last_in_cycle;
+            enc_last_count             += 1;
+        }
+        for (int i = 0;dec_out_ack && (i < data_size);i++) {
+            while ((dec_out_frame < data_ends.size()) && (dec_out_position >= data_ends[dec_out_frame])) {
+                dec_out_frame  += 1;
+            }
+            if (dec_out_position < data_stream.size()) {
+                compare("data", dec_out_frame, dec_out_position, data_stream[dec_out_position], (dec_out_position == (data_ends[dec_out_frame] - 1)), data[i], data_last && (i == (data_size - 1)), result);
+            }
+            else {
+                compare("data", dec_out_frame, dec_out_position, 0, true, data[i], data_last && (i == (data_size - 1)), result);
+            }
+            dec_out_position    += 1;
+        }
+        if (dec_out_ack && data_last) {
+            dec_last_count += 1;
+        }
+
+        if (result.cycles >= time_out) {
+            result.time_out = true;
+            break;
+        }
+    }
+    result.time = now() - start;
+
+    return result;
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+void CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::compare(const char* id, size_t frame, size_t position, uint32_t model_value, bool model_last, uint32_t dut_value, bool dut_last, Result& result) const {
+    if ((model_value == dut_value) && (model_last == dut_last)) {
+        return;
+    }
+    if (result.errors < max_message_num) {
+        cout << "Error       : " << id << "[" << position << "]"
+             << " frame " << frame
+             << " model " << hex << model_value << (model_last ? "(last)" : "")
+             << " dut "          << dut_value   << (dut_last   ? "(last)" : "") << dec << endl;
+    }
+    result.errors   += 1;
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+void CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::clear_perf_counters() {
+    access_register(dut_enc, true, 0x00, 0x1);
+    access_register(dut_dec, true, 0x00, 0x1);
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+typename CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::PerfCounter CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::get_enc_perf_counter() {
+    return read_perf_counter(dut_enc);
+}
+
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+typename CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::PerfCounter CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::get_dec_perf_counter() {
+    return read_perf_counter(dut_dec);
+}
+
+/**
+ *  APBの1転送(セットアップ/アクセスフェーズ)を行う
+ *  転送中も両方のDUTにクロックを入れる(入出力は呼び出し時の値のまま)。
+ */
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+template <typename dut_t>
+uint32_t CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::access_register(dut_t* dut, bool write, uint32_t address, uint32_t data) {
+    uint32_t    read_data;
+
+    dut->i_psel     = 1;
+    dut->i_penable  = 0;
+    dut->i_pwrite   = write;
+    dut->i_paddr    = address;
+    dut->i_pwdata   = data;
+    clock_low();
+    clock_high();
+    dut->i_penable  = 1;
+    clock_low();
+    while (!dut->o_pready) {
+        clock_high();
+        clock_low();
+    }
+    read_data       = dut->o_prdata;
+    clock_high();
+    dut->i_psel     = 0;
+    dut->i_penable  = 0;
+    dut->i_pwrite   = 0;
+
+    return read_data;
+}
+
+/**
+ *  全カウンタを読み出す(下位ワード, 上位ワードの順)
+ */
+template <int reference_size, int coding_size, int bytes_per_cycle, int decoder_bytes_per_cycle, typename model_type>
+template <typename dut_t>
+typename CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::PerfCounter CppTop<reference_size, coding_size, bytes_per_cycle, decoder_bytes_per_cycle, model_type>::read_perf_counter(dut_t* dut) {
+    PerfCounter counter = {false, 0, 0, 0, 0, 0, 0, 0, vector<uint64_t>()};
+    uint64_t    value[7];
+    uint32_t    config;
+    uint32_t    low;
+    int         bins;
+
+    config  = access_register(dut, false, 0x00);
+    if (config == 0) {
+        return counter;
+    }
+    bins    = (config >> 16) & 0xff;
+    counter.histogram.resize(bins);
+    for (int i = 0;i < (7 + bins);i++) {
+        low = access_register(dut, false, 8 * (i + 1) + 0);
+        uint64_t    count   = ((uint64_t)access_register(dut, false, 8 * (i + 1) + 4) << 32) | low;
+        if (i < 7) {
+            value[i]    = count;
+        }
+        else {
+            counter.histogram[i - 7]    = count;
+        }
+    }
+    counter.enable          = true;
+    counter.cycles          = value[0];
+    counter.data_count      = value[1];
+    counter.code_count      = value[2];
+    counter.match_count     = value[3];
+    counter.literal_count   = value[4];
+    counter.data_stalls     = value[5];
+    counter.code_stalls     = value[6];
+
+    return counter;
+}
+
+#endif /* CPP_TOP_H_ */
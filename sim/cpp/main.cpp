@@ -0,0 +1,285 @@
+/**
+ *  @file   main.cpp
+ *  @brief  SystemCカーネルを使用しないRTLシミュレーションのメイン
+ *
+ *  usage : sim_cpp [-i input_dir] [-l list_file] [-s index/count] [-f] [stimulus ...]
+ *
+ *  ファイルごとと全体のシミュレーションサイクル数/秒を表示する。
+ *  期待値はCモデル(c_model/include/lzss.h、ENCODER_TYPE = 2はlzss_hash.h)からプロセス内で生成する。
+ *  DUTのスループットは終了時に表示し、./dump/throughput.jsonにも出力する。
+ *  エンコーダのレイテンシ(最初/最後のコードまでのサイクル数)はファイルごとに表示する。
+ *  DUTに性能カウンタがある場合(build_cpp.shの-m)はファイルごとにクリアして読み出し、表示する。
+ *  -fは各スティミュラスを1 - 40バイトの短いフレームに分けて間を空けずに連続入力し、
+ *  フレームごとにCモデルの結果と比較する(フレームの区切りは擬似乱数で、結果は再現する)。
+ *  スループットはフレームごとに"<file>:<frame>"として表示する。
+ *  ビルドはsim/etc/build_cpp.shを参照。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ *  @date   0.0.01  2026/10/19  T. Ishitani     短いフレームの連続入力(-f)を追加
+ */
+
+#ifndef TIME_OUT
+#define TIME_OUT        4000000
+#endif
+
+#ifndef REFERENCE_SIZE
+#define REFERENCE_SIZE  64
+#endif
+
+#ifndef CODING_SIZE
+#define CODING_SIZE     5
+#endif
+
+#ifndef BYTES_PER_CYCLE
+#define BYTES_PER_CYCLE 1
+#endif
+
+#ifndef ENCODER_TYPE
+#define ENCODER_TYPE    0
+#endif
+
+#ifndef DECODER_BYTES_PER_CYCLE
+#define DECODER_BYTES_PER_CYCLE 1
+#endif
+
+#ifndef DECODER_TYPE
+#define DECODER_TYPE    0
+#endif
+
+#ifndef HASH_WIDTH
+#define HASH_WIDTH      10
+#endif
+
+#ifndef CANDIDATES
+#define CANDIDATES      2
+#endif
+
+#ifndef EARLY_LITERALS
+#define EARLY_LITERALS  0
+#endif
+
+#ifndef SEARCH_REGISTER_INTERVAL
+#define SEARCH_REGISTER_INTERVAL    1
+#endif
+
+#ifndef SHIFT_REGISTER
+#define SHIFT_REGISTER  0
+#endif
+
+#ifndef THREADS
+#define THREADS         0
+#endif
+
+//  -fのフレームの最大バイト数
+#ifndef MAX_FRAME_SIZE
+#define MAX_FRAME_SIZE  40
+#endif
+
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "verilated.h"
+#include "cpp_top.h"
+#include "cpp_stimulus.h"
+
+using namespace std;
+
+//  lzss_enc_hash_top(ENCODER_TYPE = 2)の期待値はハッシュ索引の方針で生成する
+#if ENCODER_TYPE == 2
+typedef LzssHash<REFERENCE_SIZE, CODING_SIZE, HASH_WIDTH, CANDIDATES>   model_t;
+#else
+typedef Lzss<REFERENCE_SIZE, CODING_SIZE>                               model_t;
+#endif
+typedef CppTop<REFERENCE_SIZE, CODING_SIZE, BYTES_PER_CYCLE, DECODER_BYTES_PER_CYCLE, model_t>   top_t;
+
+/**
+ *  性能カウンタを表示する
+ */
+static void report_perf_counter(const char* name, const top_t::PerfCounter& counter) {
+    if (!counter.enable) {
+        return;
+    }
+    cout << "Perf        : " << name
+         << " cycles "      << counter.cycles
+         << " data "        << counter.data_count
+         << " codes "       << counter.code_count
+         << " match "       << counter.match_count
+         << " literal "     << counter.literal_count
+         << " data stall "  << counter.data_stalls
+         << " code stall "  << counter.code_stalls << endl;
+    cout << "Match Length: " << name;
+    for (size_t i = 0;i < counter.histogram.size();i++) {
+        cout << " " << (i + 2) << ((i == (counter.histogram.size() - 1)) ? "+:" : ":") << counter.histogram[i];
+    }
+    cout << endl;
+}
+
+/**
+ *  データを1 - MAX_FRAME_SIZEバイトのフレームに分ける(擬似乱数はxorshift32、結果は再現する)
+ *  フレーム名は"<name>:<frame>"としてnamesに追加する。
+ */
+static void split_frames(const data_stream_t& data_stream, const string& name, uint32_t& random_state, vector<data_stream_t>& frames, vector<string>& names) {
+    char    frame_name[32];
+    size_t  position    = 0;
+    size_t  size;
+
+    frames.clear();
+    while (position < data_stream.size()) {
+        random_state   ^= random_state << 13;
+        random_state   ^= random_state >> 17;
+        random_state   ^= random_state << 5;
+        size            = 1 + (random_state % MAX_FRAME_SIZE);
+        if (size > (data_stream.size() - position)) {
+            size    = data_stream.size() - position;
+        }
+        frames.push_back(data_stream_t(data_stream.begin() + position, data_stream.begin() + position + size));
+        snprintf(frame_name, sizeof(frame_name), ":%u", (unsigned int)(frames.size() - 1));
+        names.push_back(name + frame_name);
+        position       += size;
+    }
+}
+
+/**
+ *  DUTのスループットを表示し、JSONファイルに出力する(sim/env/top.hと同じ形式)
+ */
+static void report_throughput(top_t* top, const vector<string>& stimulus, const string& file) {
+    ofstream    ofs(file.c_str());
+
+    top->get_enc_throughput().report(cout, "dut_enc", stimulus);
+    top->get_dec_throughput().report(cout, "dut_dec", stimulus);
+
+    if (!ofs) {
+        cout << "Warning     : can not open " << file << endl;
+        return;
+    }
+    ofs << "{\n"
+        << "  \"reference_size\" : " << REFERENCE_SIZE << ",\n"
+        << "  \"coding_size\" : "    << CODING_SIZE    << ",\n"
+        << "  \"bytes_per_cycle\" : " << BYTES_PER_CYCLE << ",\n"
+        << "  \"encoder_type\" : "   << ENCODER_TYPE   << ",\n"
+        << "  \"decoder_type\" : "   << DECODER_TYPE   << ",\n"
+        << "  \"decoder_bytes_per_cycle\" : " << DECODER_BYTES_PER_CYCLE << ",\n"
+        << "  \"early_literals\" : " << EARLY_LITERALS << ",\n"
+        << "  \"search_register_interval\" : " << SEARCH_REGISTER_INTERVAL << ",\n"
+        << "  \"shift_register\" : "  << SHIFT_REGISTER << ",\n"
+        << "  \"threads\" : "        << THREADS        << ",\n"
+        << "  \"dut_enc\" : ";
+    top->get_enc_throughput().write_json(ofs, stimulus, "  ");
+    ofs << ",\n"
+        << "  \"dut_dec\" : ";
+    top->get_dec_throughput().write_json(ofs, stimulus, "  ");
+    ofs << "\n}\n";
+}
+
+int main(int argc, char* argv[]) {
+    VerilatedContext*   context = new VerilatedContext;
+    top_t*              top;
+    top_t::Result       result;
+    CppStimulus         stimulus;
+    string              file;
+    data_stream_t       data_stream;
+    vector<data_stream_t>   frames;
+    vector<string>      throughput_names;
+    bool                frame_mode;
+    uint32_t            random_state    = 0x12345678;
+    uint64_t            total_cycles    = 0;
+    double              total_time      = 0.0;
+    int                 info_count      = 0;
+    int                 error_count     = 0;
+    int                 fatal_count     = 0;
+
+    context->commandArgs(argc, argv);
+    if (!stimulus.parse_arguments(argc, argv, false, "f")) {
+        cout << "Usage : " << argv[0] << " [-i input_dir] [-l list_file] [-s index/count] [-f] [stimulus ...]" << endl;
+        return 1;
+    }
+    frame_mode  = stimulus.has_flag('f');
+
+    cout << "Reference Size : " << REFERENCE_SIZE   << endl;
+    cout << "Coding Size    : " << CODING_SIZE      << endl;
+    cout << "Bytes/Cycle    : " << BYTES_PER_CYCLE  << endl;
+    cout << "Encoder Type   : " << ENCODER_TYPE     << endl;
+    cout << "Decoder Type   : " << DECODER_TYPE     << endl;
+    cout << "Dec Bytes/Cycle: " << DECODER_BYTES_PER_CYCLE << endl;
+    cout << "Early Literals : " << EARLY_LITERALS   << endl;
+    cout << "Search Interval: " << SEARCH_REGISTER_INTERVAL << endl;
+    cout << "Shift Register : " << SHIFT_REGISTER   << endl;
+    cout << "Threads        : " << THREADS          << endl;
+    if (frame_mode) {
+        cout << "Frame Size     : 1 - " << MAX_FRAME_SIZE << endl;
+    }
+
+    //  早期リテラルはlzss_enc_top(ENCODER_TYPE = 0)のみ
+#if ENCODER_TYPE == 0
+    top = new top_t(context, TIME_OUT, model_t(false, EARLY_LITERALS));
+#else
+    top = new top_t(context, TIME_OUT);
+#endif
+    for (size_t i = 0;i < stimulus.list.size();i++) {
+        file    = stimulus.data_in_dir + "/" + stimulus.list[i];
+        ifstream    ifs(file.c_str(), ios::binary);
+        if (!ifs) {
+            cout << "Fatal       : can not open " << file << endl;
+            fatal_count += 1;
+            break;
+        }
+        data_stream.assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+
+        top->clear_perf_counters();
+        if (frame_mode) {
+            split_frames(data_stream, stimulus.list[i], random_state, frames, throughput_names);
+            result  = top->run(frames);
+        }
+        else {
+            throughput_names.push_back(stimulus.list[i]);
+            result  = top->run(data_stream);
+        }
+        total_cycles    += result.cycles;
+        total_time      += result.time;
+
+        cout << "File        : " << file                                    << endl;
+        cout << "Input Size  : " << result.data_size << "bytes"             << endl;
+        if (frame_mode) {
+            cout << "Frames      : " << frames.size()                       << endl;
+        }
+        cout << "Code Size   : " << result.code_size << "codes"             << endl;
+        cout << "Cycles      : " << result.cycles                           << endl;
+        cout << "First Code  : " << result.first_code_latency << "cycles"   << endl;
+        cout << "Last Code   : " << result.last_code_latency  << "cycles"   << endl;
+        cout << "Cycles/sec  : " << ((result.time > 0.0) ? (result.cycles / result.time) : 0.0) << endl;
+        report_perf_counter("dut_enc", top->get_enc_perf_counter());
+        report_perf_counter("dut_dec", top->get_dec_perf_counter());
+        info_count  += 1;
+        error_count += result.errors;
+        if (result.time_out) {
+            cout << "Fatal       : time out" << endl;
+            fatal_count += 1;
+            break;
+        }
+    }
+    report_throughput(top, throughput_names, "./dump/throughput.json");
+    delete  top;
+    delete  context;
+
+    cout << "------------------------------------------------"                     << endl;
+    cout << "Total Cycles     : " << total_cycles                                   << endl;
+    cout << "Total Time       : " << total_time << "s"                              << endl;
+    cout << "Total Cycles/sec : " << ((total_time > 0.0) ? (total_cycles / total_time) : 0.0)  << endl;
+    cout << "------------------------------------------------"                     << endl;
+    cout << "Message Information"                                                   << endl;
+    cout << "Info  : " << info_count                                                << endl;
+    cout << "Error : " << error_count                                               << endl;
+    cout << "Fatal : " << fatal_count                                               << endl;
+
+    return 0;
+}
@@ -10,45 +10,120 @@
 `define dCodingSize     5
 `endif
 
+`ifndef dDecoderBytesPerCycle
+`define dDecoderBytesPerCycle   1
+`endif
+
+//  0 : lzss_dec_top        (参照部をシフトレジスタに保持)
+//  1 : lzss_dec_ram_top    (参照部をRAMの循環バッファに保持)
+`ifndef dDecoderType
+`define dDecoderType    0
+`endif
+
+//  1 : 性能カウンタあり(lzss_enc_top/lzss_dec_topのみ)
+`ifndef dPerfCounter
+`define dPerfCounter    0
+`endif
+
 module dut_dec #(
     parameter   pDataWidth      = `dDataWidth,
     parameter   pReferenceSize  = `dReferenceSize,
     parameter   pCodingSize     = `dCodingSize,
+    parameter   pBytesPerCycle  = `dDecoderBytesPerCycle,
+    parameter   pDecoderType    = `dDecoderType,
+    parameter   pPerfCounter    = `dPerfCounter,
     parameter   pCodeWidth      = get_code_width(
                                             pDataWidth,
                                             pReferenceSize,
                                             pCodingSize
-                                          )
+                                          ),
+    parameter   pOutputWidth    = pDataWidth * pBytesPerCycle
 )(
-    input                           clk,
-    input                           rst_x,
-    input                           i_valid,
-    output                          ow_ready,
-    input       [pCodeWidth-1:0]    i_code,
-    input                           i_last,
-    output                          o_valid,
-    input                           i_ready,
-    output      [pDataWidth-1:0]    o_data,
-    output                          o_last
+    input                               clk,
+    input                               rst_x,
+    input                               i_valid,
+    output                              ow_ready,
+    input       [pCodeWidth-1:0]        i_code,
+    input                               i_last,
+    output                              o_valid,
+    input                               i_ready,
+    output      [pOutputWidth-1:0]      o_data,
+    output      [pBytesPerCycle-1:0]    o_keep,
+    output                              o_last,
+    input                               i_psel,
+    input                               i_penable,
+    input                               i_pwrite,
+    input       [7:0]                   i_paddr,
+    input       [31:0]                  i_pwdata,
+    output      [31:0]                  o_prdata,
+    output                              o_pready
 );
 
     `include "lzss_function.vh"
 
-    lzss_dec_top #(
-        .pDataWidth     (pDataWidth     ),
-        .pReferenceSize (pReferenceSize ),
-        .pCodingSize    (pCodingSize    )
-    ) u_dut_dec (
-        .clk        (clk        ),
-        .rst_x      (rst_x      ),
-        .i_valid    (i_valid    ),
-        .ow_ready   (ow_ready   ),
-        .i_code     (i_code     ),
-        .i_last     (i_last     ),
-        .o_valid    (o_valid    ),
-        .i_ready    (i_ready    ),
-        .o_data     (o_data     ),
-        .o_last     (o_last     )
-    );
+    generate
+        if (pDecoderType == 1) begin : ram
+            wire    [pDataWidth-1:0]    w_data;
+
+            lzss_dec_ram_top #(
+                .pDataWidth     (pDataWidth     ),
+                .pReferenceSize (pReferenceSize ),
+                .pCodingSize    (pCodingSize    )
+            ) u_dut_dec (
+                .clk        (clk        ),
+                .rst_x      (rst_x      ),
+                .i_valid    (i_valid    ),
+                .ow_ready   (ow_ready   ),
+                .i_code     (i_code     ),
+                .i_last     (i_last     ),
+                .o_valid    (o_valid    ),
+                .i_ready    (i_ready    ),
+                .o_data     (w_data     ),
+                .o_last     (o_last     )
+            );
+
+            //  性能カウンタなし
+            assign  o_prdata    = 32'h0;
+            assign  o_pready    = 1'b1;
+
+            //  データは1ビートに1バイト(下位レーン)
+            if (pBytesPerCycle == 1) begin : single
+                assign  o_data  = w_data;
+                assign  o_keep  = 1'b1;
+            end
+            else begin : multi
+                assign  o_data  = {{(pOutputWidth-pDataWidth){1'b0}}, w_data};
+                assign  o_keep  = {{(pBytesPerCycle-1){1'b0}}, 1'b1};
+            end
+        end
+        else begin : shift_register
+            lzss_dec_top #(
+                .pDataWidth     (pDataWidth     ),
+                .pReferenceSize (pReferenceSize ),
+                .pCodingSize    (pCodingSize    ),
+                .pBytesPerCycle (pBytesPerCycle ),
+                .pPerfCounter   (pPerfCounter   )
+            ) u_dut_dec (
+                .clk        (clk        ),
+                .rst_x      (rst_x      ),
+                .i_valid    (i_valid    ),
+                .ow_ready   (ow_ready   ),
+                .i_code     (i_code     ),
+                .i_last     (i_last     ),
+                .o_valid    (o_valid    ),
+                .i_ready    (i_ready    ),
+                .o_data     (o_data     ),
+                .o_keep     (o_keep     ),
+                .o_last     (o_last     ),
+                .i_psel     (i_psel     ),
+                .i_penable  (i_penable  ),
+                .i_pwrite   (i_pwrite   ),
+                .i_paddr    (i_paddr    ),
+                .i_pwdata   (i_pwdata   ),
+                .o_prdata   (o_prdata   ),
+                .o_pready   (o_pready   )
+            );
+        end
+    endgenerate
 
 endmodule
@@ -10,46 +10,199 @@
 `define dCodingSize     5
 `endif
 
+`ifndef dBytesPerCycle
+`define dBytesPerCycle  1
+`endif
+
+//  0 : lzss_enc_top        (符号化位置ごとのパイプライン)
+//  1 : lzss_enc_shift_top  (1コード/サイクル、可変シフト)
+//  2 : lzss_enc_hash_top   (RAM履歴 + ハッシュ索引、1バイト/サイクル)
+`ifndef dEncoderType
+`define dEncoderType    0
+`endif
+
+//  lzss_enc_top(dEncoderType = 0)のみ
+`ifndef dEarlyLiterals
+`define dEarlyLiterals  0
+`endif
+
+`ifndef dSearchRegisterInterval
+`define dSearchRegisterInterval 1
+`endif
+
+//  lzss_enc_shift_top(dEncoderType = 1)のみ
+//  1 : シフト数をレジスタで受ける(2サイクルで1コード)
+`ifndef dShiftRegister
+`define dShiftRegister  0
+`endif
+
+//  1 : 性能カウンタあり(lzss_enc_top/lzss_dec_topのみ)
+`ifndef dPerfCounter
+`define dPerfCounter    0
+`endif
+
+`ifndef dHashWidth
+`define dHashWidth      10
+`endif
+
+`ifndef dCandidates
+`define dCandidates     2
+`endif
+
 module dut_enc #(
     parameter   pDataWidth      = `dDataWidth,
     parameter   pReferenceSize  = `dReferenceSize,
     parameter   pCodingSize     = `dCodingSize,
+    parameter   pBytesPerCycle  = `dBytesPerCycle,
+    parameter   pEncoderType    = `dEncoderType,
+    parameter   pEarlyLiterals  = `dEarlyLiterals,
+    parameter   pSearchRegisterInterval = `dSearchRegisterInterval,
+    parameter   pShiftRegister  = `dShiftRegister,
+    parameter   pPerfCounter    = `dPerfCounter,
+    parameter   pHashWidth      = `dHashWidth,
+    parameter   pCandidates     = `dCandidates,
     parameter   pCodeWidth      = get_code_width(
                                             pDataWidth,
                                             pReferenceSize,
                                             pCodingSize
-                                          )
+                                          ),
+    parameter   pInputWidth     = pDataWidth * pBytesPerCycle,
+    parameter   pOutputWidth    = pCodeWidth * pBytesPerCycle
 )(
     input                               clk,
     input                               rst_x,
     input                               i_valid,
     output                              ow_ready,
-    input       [pDataWidth-1:0]        i_data,
+    input       [pInputWidth-1:0]       i_data,
+    input       [pBytesPerCycle-1:0]    i_keep,
     input                               i_last,
     output                              o_valid,
     input                               i_ready,
-    output      [pCodeWidth-1:0]        o_code,
-    output                              o_last
+    output      [pOutputWidth-1:0]      o_code,
+    output      [pBytesPerCycle-1:0]    o_keep,
+    output                              o_last,
+    input                               i_psel,
+    input                               i_penable,
+    input                               i_pwrite,
+    input       [7:0]                   i_paddr,
+    input       [31:0]                  i_pwdata,
+    output      [31:0]                  o_prdata,
+    output                              o_pready
 );
 
 
     `include "lzss_function.vh"
 
-    lzss_enc_top #(
-        .pDataWidth     (pDataWidth     ),
-        .pReferenceSize (pReferenceSize ),
-        .pCodingSize    (pCodingSize    )
-    ) u_dut_enc (
-        .clk        (clk        ),
-        .rst_x      (rst_x      ),
-        .i_valid    (i_valid    ),
-        .ow_ready   (ow_ready   ),
-        .i_data     (i_data     ),
-        .i_last     (i_last     ),
-        .o_valid    (o_valid    ),
-        .i_ready    (i_ready    ),
-        .o_code     (o_code     ),
-        .o_last     (o_last     )
-    );
+    generate
+        if (((pEncoderType == 2) && (pBytesPerCycle != 1)) ||
+            ((pEncoderType != 0) && ((pEarlyLiterals != 0) || (pSearchRegisterInterval != 1))) ||
+            ((pEncoderType != 1) && (pShiftRegister != 0))) begin : illegal
+            //  lzss_enc_hash_topは1サイクル1バイトのみ(i_keepなし)で、上位レーンが捨てられる
+            //  pEarlyLiterals/pSearchRegisterIntervalはlzss_enc_topのみで、他のエンコーダでは無視される
+            //  pShiftRegisterはlzss_enc_shift_topのみ
+            //  不正な組み合わせではエンコーダを置かずに入出力を止める(ow_ready/o_validとも0)
+            assign  ow_ready    = 1'b0;
+            assign  o_valid     = 1'b0;
+            assign  o_code      = {pOutputWidth{1'b0}};
+            assign  o_keep      = {pBytesPerCycle{1'b0}};
+            assign  o_last      = 1'b0;
+            assign  o_prdata    = 32'h0;
+            assign  o_pready    = 1'b1;
+        end
+        else if (pEncoderType == 2) begin : hash
+            //  入力は1サイクル1バイトのみ(pBytesPerCycle = 1、illegal参照)
+            lzss_enc_hash_top #(
+                .pDataWidth     (pDataWidth     ),
+                .pReferenceSize (pReferenceSize ),
+                .pCodingSize    (pCodingSize    ),
+                .pHashWidth     (pHashWidth     ),
+                .pCandidates    (pCandidates    )
+            ) u_dut_enc (
+                .clk        (clk                        ),
+                .rst_x      (rst_x                      ),
+                .i_valid    (i_valid                    ),
+                .ow_ready   (ow_ready                   ),
+                .i_data     (i_data[pDataWidth-1:0]     ),
+                .i_last     (i_last                     ),
+                .o_valid    (o_valid                    ),
+                .i_ready    (i_ready                    ),
+                .o_code     (o_code                     ),
+                .o_last     (o_last                     )
+            );
+
+            //  性能カウンタなし
+            assign  o_prdata    = 32'h0;
+            assign  o_pready    = 1'b1;
+            assign  o_keep      = 1'b1;
+        end
+        else if (pEncoderType == 1) begin : shift
+            wire    [pCodeWidth-1:0]    w_code;
+
+            lzss_enc_shift_top #(
+                .pDataWidth     (pDataWidth     ),
+                .pReferenceSize (pReferenceSize ),
+                .pCodingSize    (pCodingSize    ),
+                .pBytesPerCycle (pBytesPerCycle ),
+                .pShiftRegister (pShiftRegister )
+            ) u_dut_enc (
+                .clk        (clk        ),
+                .rst_x      (rst_x      ),
+                .i_valid    (i_valid    ),
+                .ow_ready   (ow_ready   ),
+                .i_data     (i_data     ),
+                .i_keep     (i_keep     ),
+                .i_last     (i_last     ),
+                .o_valid    (o_valid    ),
+                .i_ready    (i_ready    ),
+                .o_code     (w_code     ),
+                .o_last     (o_last     )
+            );
+
+            //  性能カウンタなし
+            assign  o_prdata    = 32'h0;
+            assign  o_pready    = 1'b1;
+
+            //  コードは1ビートに1個(下位レーン)
+            if (pBytesPerCycle == 1) begin : single
+                assign  o_code  = w_code;
+                assign  o_keep  = 1'b1;
+            end
+            else begin : multi
+                assign  o_code  = {{(pOutputWidth-pCodeWidth){1'b0}}, w_code};
+                assign  o_keep  = {{(pBytesPerCycle-1){1'b0}}, 1'b1};
+            end
+        end
+        else begin : pipeline
+            lzss_enc_top #(
+                .pDataWidth                 (pDataWidth             ),
+                .pReferenceSize             (pReferenceSize         ),
+                .pCodingSize                (pCodingSize            ),
+                .pBytesPerCycle             (pBytesPerCycle         ),
+                .pEarlyLiterals             (pEarlyLiterals         ),
+                .pSearchRegisterInterval    (pSearchRegisterInterval),
+                .pPerfCounter               (pPerfCounter           )
+            ) u_dut_enc (
+                .clk        (clk        ),
+                .rst_x      (rst_x      ),
+                .i_valid    (i_valid    ),
+                .ow_ready   (ow_ready   ),
+                .i_data     (i_data     ),
+                .i_keep     (i_keep     ),
+                .i_last     (i_last     ),
+                .o_valid    (o_valid    ),
+                .i_ready    (i_ready    ),
+                .o_code     (o_code     ),
+                .o_keep     (o_keep     ),
+                .o_last     (o_last     ),
+                .i_psel     (i_psel     ),
+                .i_penable  (i_penable  ),
+                .i_pwrite   (i_pwrite   ),
+                .i_paddr    (i_paddr    ),
+                .i_pwdata   (i_pwdata   ),
+                .o_prdata   (o_prdata   ),
+                .o_pready   (o_pready   )
+            );
+        end
+    endgenerate
 
 endmodule
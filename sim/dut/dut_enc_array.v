@@ -0,0 +1,85 @@
+`ifndef dDataWidth
+`define dDataWidth      8
+`endif
+
+`ifndef dReferenceSize
+`define dReferenceSize  64
+`endif
+
+`ifndef dCodingSize
+`define dCodingSize     5
+`endif
+
+`ifndef dBytesPerCycle
+`define dBytesPerCycle  1
+`endif
+
+`ifndef dLanes
+`define dLanes          4
+`endif
+
+`ifndef dIdWidth
+`define dIdWidth        4
+`endif
+
+module dut_enc_array #(
+    parameter   pDataWidth      = `dDataWidth,
+    parameter   pReferenceSize  = `dReferenceSize,
+    parameter   pCodingSize     = `dCodingSize,
+    parameter   pBytesPerCycle  = `dBytesPerCycle,
+    parameter   pLanes          = `dLanes,
+    parameter   pIdWidth        = `dIdWidth,
+    parameter   pBeatSize       = pLanes * pBytesPerCycle,
+    parameter   pCodeWidth      = get_code_width(
+                                            pDataWidth,
+                                            pReferenceSize,
+                                            pCodingSize
+                                          ),
+    parameter   pInputWidth     = pDataWidth * pBeatSize,
+    parameter   pOutputWidth    = pCodeWidth * pBeatSize
+)(
+    input                               clk,
+    input                               rst_x,
+    input                               i_valid,
+    output                              ow_ready,
+    input       [pIdWidth-1:0]          i_id,
+    input       [pInputWidth-1:0]       i_data,
+    input       [pBeatSize-1:0]         i_keep,
+    input                               i_last,
+    output                              o_valid,
+    input                               i_ready,
+    output      [pIdWidth-1:0]          o_id,
+    output      [pOutputWidth-1:0]      o_code,
+    output      [pBeatSize-1:0]         o_keep,
+    output                              o_last
+);
+
+    `include "lzss_function.vh"
+
+    lzss_enc_array_top #(
+        .pDataWidth     (pDataWidth     ),
+        .pReferenceSize (pReferenceSize ),
+        .pCodingSize    (pCodingSize    ),
+        .pBytesPerCycle (pBytesPerCycle ),
+        .pLanes         (pLanes         ),
+        .pIdWidth       (pIdWidth       ),
+        .pInputBytes    (pBeatSize      ),
+        .pOutputCodes   (pBeatSize      )
+    ) u_dut_enc (
+        .clk        (clk        ),
+        .rst_x      (rst_x      ),
+        .i_valid    (i_valid    ),
+        .ow_ready   (ow_ready   ),
+        .i_id       (i_id       ),
+        .i_data     (i_data     ),
+        .i_keep     (i_keep     ),
+        .i_last     (i_last     ),
+        .o_valid    (o_valid    ),
+        .i_ready    (i_ready    ),
+        .o_id       (o_id       ),
+        .o_code     (o_code     ),
+        .o_keep     (o_keep     ),
+        .o_last     (o_last     )
+    );
+
+endmodule
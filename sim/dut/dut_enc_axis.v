@@ -0,0 +1,71 @@
+`ifndef dDataWidth
+`define dDataWidth      8
+`endif
+
+`ifndef dReferenceSize
+`define dReferenceSize  64
+`endif
+
+`ifndef dCodingSize
+`define dCodingSize     5
+`endif
+
+`ifndef dBytesPerCycle
+`define dBytesPerCycle  8
+`endif
+
+`ifndef dAxisBytes
+`define dAxisBytes      8
+`endif
+
+module dut_enc_axis #(
+    parameter   pDataWidth      = `dDataWidth,
+    parameter   pReferenceSize  = `dReferenceSize,
+    parameter   pCodingSize     = `dCodingSize,
+    parameter   pBytesPerCycle  = `dBytesPerCycle,
+    parameter   pAxisBytes      = `dAxisBytes,
+    parameter   pAxisWidth      = 8 * pAxisBytes
+)(
+    input                               clk,
+    input                               rst_x,
+    input                               i_s_tvalid,
+    output                              ow_s_tready,
+    input       [pAxisWidth-1:0]        i_s_tdata,
+    input       [pAxisBytes-1:0]        i_s_tkeep,
+    input                               i_s_tlast,
+    output                              o_m_tvalid,
+    input                               i_m_tready,
+    output      [pAxisWidth-1:0]        o_m_tdata,
+    output      [pAxisBytes-1:0]        o_m_tkeep,
+    output                              o_m_tlast
+);
+
+    lzss_enc_axis_top #(
+        .pDataWidth     (pDataWidth     ),
+        .pReferenceSize (pReferenceSize ),
+        .pCodingSize    (pCodingSize    ),
+        .pBytesPerCycle (pBytesPerCycle ),
+        .pAxisBytes     (pAxisBytes     )
+    ) u_dut_enc (
+        .clk            (clk            ),
+        .rst_x          (rst_x          ),
+        .i_s_tvalid     (i_s_tvalid     ),
+        .ow_s_tready    (ow_s_tready    ),
+        .i_s_tdata      (i_s_tdata      ),
+        .i_s_tkeep      (i_s_tkeep      ),
+        .i_s_tlast      (i_s_tlast      ),
+        .o_m_tvalid     (o_m_tvalid     ),
+        .i_m_tready     (i_m_tready     ),
+        .o_m_tdata      (o_m_tdata      ),
+        .o_m_tkeep      (o_m_tkeep      ),
+        .o_m_tlast      (o_m_tlast      ),
+        .i_psel         (1'b0           ),
+        .i_penable      (1'b0           ),
+        .i_pwrite       (1'b0           ),
+        .i_paddr        (8'h00          ),
+        .i_pwdata       (32'h0          ),
+        .o_prdata       (               ),
+        .o_pready       (               )
+    );
+
+endmodule
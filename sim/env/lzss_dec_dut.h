@@ -17,6 +17,7 @@
 #include <stdint.h>
 #include "systemc.h"
 #include "lzss_type.h"
+#include "lzss_dut_throughput.h"
 #include "Vdut_dec.h"
 #include "verilated_vcd_sc.h"
 
@@ -42,6 +43,10 @@ public:
     virtual void trace(sc_trace_file* tr) const;
     virtual void trace(VerilatedVcdSc* tr);
 
+    const DutThroughput& get_throughput() const {
+        return throughput;
+    }
+
 protected:
     code_packet_t   code;
     data_packet_t   data;
@@ -56,22 +61,39 @@ protected:
     sc_signal<bool>     i_last;
     sc_signal<bool>     o_valid;
     sc_signal<bool>     i_ready;
-    sc_signal<uint32_t> o_data;
+    sc_signal<uint32_t> o_data;     //  dDecoderBytesPerCycle = 1のみ対応
+    sc_signal<bool>     o_keep;
     sc_signal<bool>     o_last;
+    //  性能カウンタ(このテストベンチでは未使用)
+    sc_signal<bool>     i_psel;
+    sc_signal<bool>     i_penable;
+    sc_signal<bool>     i_pwrite;
+    sc_signal<uint32_t> i_paddr;
+    sc_signal<uint32_t> i_pwdata;
+    sc_signal<uint32_t> o_prdata;
+    sc_signal<bool>     o_pready;
+
+    //  スループット計測
+    DutThroughput       throughput;
 
     void input_thread();
     void output_thread();
+    void monitor_method();
 };
 
 template <int reference_size, int coding_size>
 LzssDecDut<reference_size, coding_size>::LzssDecDut(const sc_module_name& name) :
     sc_module   (name),
-    dut         ("dut")
+    dut         ("dut"),
+    throughput  (false)
 {
     SC_CTHREAD(input_thread, clk.pos());
     reset_signal_is(rst_x, false);
     SC_CTHREAD(output_thread, clk.pos());
     reset_signal_is(rst_x, false);
+    SC_METHOD(monitor_method);
+    sensitive << clk.pos();
+    dont_initialize();
 
     dut.clk(clk);
     dut.rst_x(rst_x);
@@ -82,7 +104,15 @@ LzssDecDut<reference_size, coding_size>::LzssDecDut(const sc_module_name& name)
     dut.o_valid(o_valid);
     dut.i_ready(i_ready);
     dut.o_data(o_data);
+    dut.o_keep(o_keep);
     dut.o_last(o_last);
+    dut.i_psel(i_psel);
+    dut.i_penable(i_penable);
+    dut.i_pwrite(i_pwrite);
+    dut.i_paddr(i_paddr);
+    dut.i_pwdata(i_pwdata);
+    dut.o_prdata(o_prdata);
+    dut.o_pready(o_pready);
 }
 
 template <int reference_size, int coding_size>
@@ -152,4 +182,13 @@ void LzssDecDut<reference_size, coding_size>::output_thread() {
     }
 }
 
+template <int reference_size, int coding_size>
+void LzssDecDut<reference_size, coding_size>::monitor_method() {
+    //  立ち上がり時点の(更新前の)信号値でハンドシェイクを判定する
+    if (!rst_x.read()) {
+        return;
+    }
+    throughput.sample(i_valid.read(), ow_ready.read(), i_last.read(), o_valid.read(), i_ready.read(), o_last.read());
+}
+
 #endif /* LZSS_DEC_DUT_H_ */
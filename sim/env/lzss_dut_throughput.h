@@ -0,0 +1,213 @@
+/**
+ *  @file   lzss_dut_throughput.h
+ *  @brief  DUTのスループット計測
+ *
+ *  クロックごとにDUTの入出力ハンドシェイク信号をサンプリングし、
+ *  入力/出力ビート数とデータ(コード)数、サイクル数、ow_ready待ち/i_ready待ちのストールサイクル数を
+ *  ファイル(フレーム)単位で集計する。1ビートで複数データを転送するDUTでは
+ *  ビートごとの有効データ数を与える。
+ *  入力ビート/ストールはi_last付きの入力ビートまでを、出力ビート/ストールはラスト付き出力までを
+ *  そのフレームに数える(前のフレームの出力中に次のフレームの入力が始まってもよい)。
+ *  1ファイルのサイクル数は、前のファイルのラスト出力(入力していない期間の後は最初の入力バリッド)から
+ *  そのファイルのラスト出力までとする。
+ *
+ *  @par    Copyright
+ *  (C) 2012 Taichi Ishitani All Rights Reserved.
+ *
+ *  @author Taichi Ishitani
+ *
+ *  @date   0.0.00  2026/10/19  T. Ishitani     coding start
+ */
+
+#ifndef LZSS_DUT_THROUGHPUT_H_
+#define LZSS_DUT_THROUGHPUT_H_
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <deque>
+#include <stdint.h>
+
+using namespace std;
+
+class DutThroughput {
+public:
+    struct Record {
+        uint64_t    input_beats;
+        uint64_t    output_beats;
+        uint64_t    input_items;
+        uint64_t    output_items;
+        uint64_t    cycles;
+        uint64_t    input_stalls;   //  i_valid & ~ow_ready
+        uint64_t    output_stalls;  //  o_valid & ~i_ready
+
+        Record() :
+            input_beats     (0),
+            output_beats    (0),
+            input_items     (0),
+            output_items    (0),
+            cycles          (0),
+            input_stalls    (0),
+            output_stalls   (0)
+        {}
+
+        Record& operator +=(const Record& record) {
+            input_beats     += record.input_beats;
+            output_beats    += record.output_beats;
+            input_items     += record.input_items;
+            output_items    += record.output_items;
+            cycles          += record.cycles;
+            input_stalls    += record.input_stalls;
+            output_stalls   += record.output_stalls;
+            return *this;
+        }
+    };
+
+    /**
+     *  @param  data_on_input   バイト数として入力側のデータ数を使用する(エンコーダ)
+     */
+    DutThroughput(bool data_on_input) :
+        data_on_input   (data_on_input),
+        input_open      (false)
+    {}
+
+    //  クロック立ち上がりで成立するハンドシェイク信号とビート内の有効データ数を与える
+    void sample(bool i_valid, bool ow_ready, bool i_last, bool o_valid, bool i_ready, bool o_last, int input_size = 1, int output_size = 1) {
+        if (frames.empty() && (!i_valid)) {
+            return;
+        }
+        output_frame().cycles   += 1;
+        if (i_valid) {
+            Record& record  = input_frame();
+            if (ow_ready) {
+                record.input_beats      += 1;
+                record.input_items      += input_size;
+                input_open               = !i_last;
+            }
+            else {
+                record.input_stalls     += 1;
+            }
+        }
+        if (o_valid) {
+            Record& record  = output_frame();
+            if (i_ready) {
+                record.output_beats     += 1;
+                record.output_items     += output_size;
+            }
+            else {
+                record.output_stalls    += 1;
+            }
+        }
+        if (o_valid && i_ready && o_last) {
+            records.push_back(frames.front());
+            frames.pop_front();
+        }
+    }
+
+    const vector<Record>& get_records() const {
+        return records;
+    }
+
+    Record total() const {
+        Record  record;
+        for (size_t i = 0;i < records.size();i++) {
+            record  += records[i];
+        }
+        return record;
+    }
+
+    double bytes_per_cycle(const Record& record) const {
+        if (record.cycles == 0) {
+            return 0.0;
+        }
+        return (double)((data_on_input) ? record.input_items : record.output_items) / record.cycles;
+    }
+
+    void report(ostream& os, const string& id, const vector<string>& files) const {
+        os << "------------------------------------------------" << endl;
+        os << "Throughput : " << id << endl;
+        os << setw(24) << left  << "file"
+           << setw(12) << right << "input"
+           << setw(12) << right << "output"
+           << setw(12) << right << "cycles"
+           << setw(12) << right << "in stall"
+           << setw(12) << right << "out stall"
+           << setw(12) << right << "byte/cycle" << endl;
+        for (size_t i = 0;i < records.size();i++) {
+            report_record(os, (i < files.size()) ? files[i] : "-", records[i]);
+        }
+        report_record(os, "total", total());
+    }
+
+    void write_json(ostream& os, const vector<string>& files, const string& indent) const {
+        os << "{\n" << indent << "  \"files\" : [";
+        for (size_t i = 0;i < records.size();i++) {
+            os << ((i == 0) ? "\n" : ",\n") << indent << "    ";
+            write_json_record(os, (i < files.size()) ? files[i] : "", records[i]);
+        }
+        os << "\n" << indent << "  ],\n" << indent << "  \"total\" : ";
+        write_json_record(os, "total", total());
+        os << "\n" << indent << "}";
+    }
+
+protected:
+    const bool      data_on_input;
+    bool            input_open;     //  frames.back()の入力がi_lastまで終わっていない
+    deque<Record>   frames;         //  出力が終わっていないフレーム(先頭が出力中、末尾が入力中)
+    vector<Record>  records;
+
+    Record& input_frame() {
+        if (frames.empty() || (!input_open)) {
+            frames.push_back(Record());
+            input_open  = true;
+        }
+        return frames.back();
+    }
+
+    Record& output_frame() {
+        if (frames.empty()) {
+            frames.push_back(Record());
+            input_open  = true;
+        }
+        return frames.front();
+    }
+
+    void report_record(ostream& os, const string& name, const Record& record) const {
+        os << setw(24) << left  << name
+           << setw(12) << right << record.input_items
+           << setw(12) << right << record.output_items
+           << setw(12) << right << record.cycles
+           << setw(12) << right << record.input_stalls
+           << setw(12) << right << record.output_stalls
+           << setw(12) << right << fixed << setprecision(4) << bytes_per_cycle(record) << endl;
+        os.unsetf(ios::fixed);
+        os << setprecision(6);
+    }
+
+    void write_json_record(ostream& os, const string& name, const Record& record) const {
+        os << "{\"name\" : \""          << json_escape(name)            << "\""
+           << ", \"input_beats\" : "    << record.input_beats
+           << ", \"output_beats\" : "   << record.output_beats
+           << ", \"input_items\" : "    << record.input_items
+           << ", \"output_items\" : "   << record.output_items
+           << ", \"cycles\" : "         << record.cycles
+           << ", \"input_stalls\" : "   << record.input_stalls
+           << ", \"output_stalls\" : "  << record.output_stalls
+           << ", \"bytes_per_cycle\" : "<< bytes_per_cycle(record)
+           << "}";
+    }
+
+    static string json_escape(const string& value) {
+        string  escaped;
+        for (size_t i = 0;i < value.size();i++) {
+            if ((value[i] == '"') || (value[i] == '\\')) {
+                escaped += '\\';
+            }
+            escaped += value[i];
+        }
+        return escaped;
+    }
+};
+
+#endif /* LZSS_DUT_THROUGHPUT_H_ */
@@ -17,6 +17,7 @@
 #include <stdint.h>
 #include "systemc.h"
 #include "lzss_type.h"
+#include "lzss_dut_throughput.h"
 #include "Vdut_enc.h"
 #include "verilated_vcd_sc.h"
 
@@ -42,6 +43,10 @@ public:
     virtual void trace(sc_trace_file* tr) const;
     virtual void trace(VerilatedVcdSc* tr);
 
+    const DutThroughput& get_throughput() const {
+        return throughput;
+    }
+
 protected:
     data_packet_t   data;
     code_packet_t   code;
@@ -53,36 +58,63 @@ protected:
     sc_signal<bool>     i_valid;
     sc_signal<bool>     ow_ready;
     sc_signal<uint32_t> i_data;
+    sc_signal<bool>     i_keep;     //  dBytesPerCycle = 1のみ対応
     sc_signal<bool>     i_last;
     sc_signal<bool>     o_valid;
     sc_signal<bool>     i_ready;
     sc_signal<uint32_t> o_code;
+    sc_signal<bool>     o_keep;
     sc_signal<bool>     o_last;
+    //  性能カウンタ(このテストベンチでは未使用)
+    sc_signal<bool>     i_psel;
+    sc_signal<bool>     i_penable;
+    sc_signal<bool>     i_pwrite;
+    sc_signal<uint32_t> i_paddr;
+    sc_signal<uint32_t> i_pwdata;
+    sc_signal<uint32_t> o_prdata;
+    sc_signal<bool>     o_pready;
+
+    //  スループット計測
+    DutThroughput       throughput;
 
     void input_thread();
     void output_thread();
+    void monitor_method();
 };
 
 template <int reference_size, int coding_size>
 LzssEncDut<reference_size, coding_size>::LzssEncDut(const sc_module_name& name) :
     sc_module   (name),
-    dut         ("dut")
+    dut         ("dut"),
+    throughput  (true)
 {
     SC_CTHREAD(input_thread, clk.pos());
     reset_signal_is(rst_x, false);
     SC_CTHREAD(output_thread, clk.pos());
     reset_signal_is(rst_x, false);
+    SC_METHOD(monitor_method);
+    sensitive << clk.pos();
+    dont_initialize();
 
     dut.clk(clk);
     dut.rst_x(rst_x);
     dut.i_valid(i_valid);
     dut.ow_ready(ow_ready);
     dut.i_data(i_data);
+    dut.i_keep(i_keep);
     dut.i_last(i_last);
     dut.o_valid(o_valid);
     dut.i_ready(i_ready);
     dut.o_code(o_code);
+    dut.o_keep(o_keep);
     dut.o_last(o_last);
+    dut.i_psel(i_psel);
+    dut.i_penable(i_penable);
+    dut.i_pwrite(i_pwrite);
+    dut.i_paddr(i_paddr);
+    dut.i_pwdata(i_pwdata);
+    dut.o_prdata(o_prdata);
+    dut.o_pready(o_pready);
 }
 
 template <int reference_size, int coding_size>
@@ -101,6 +133,7 @@ void LzssEncDut<reference_size, coding_size>::input_thread() {
     //  リセット
     i_valid.write(0);
     i_data.write(0);
+    i_keep.write(1);
     i_last.write(0);
     wait();
 
@@ -152,4 +185,13 @@ void LzssEncDut<reference_size, coding_size>::output_thread() {
     }
 }
 
+template <int reference_size, int coding_size>
+void LzssEncDut<reference_size, coding_size>::monitor_method() {
+    //  立ち上がり時点の(更新前の)信号値でハンドシェイクを判定する
+    if (!rst_x.read()) {
+        return;
+    }
+    throughput.sample(i_valid.read(), ow_ready.read(), i_last.read(), o_valid.read(), i_ready.read(), o_last.read());
+}
+
 #endif /* LZSS_ENC_DUT_H_ */
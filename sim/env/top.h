@@ -13,6 +13,7 @@
 #ifndef TOP_H_
 #define TOP_H_
 
+#include <fstream>
 #include "systemc.h"
 #include "lzss_type.h"
 #include "lzss_utility.h"
@@ -59,6 +60,7 @@ protected:
     virtual void start_of_simulation();
     virtual void end_of_simulation();
     void set_stimulus();
+    void report_throughput();
 };
 
 template <int reference_size, int coding_size>
@@ -71,7 +73,13 @@ Top<reference_size, coding_size>::Top(const sc_module_name& name, double cycle_t
     stimulus.code_out_dir   = "./encode";
     stimulus.data_out_dir   = "./decode";
     stimulus.dump_dir       = "./dump";
-    set_stimulus();
+    if (!stimulus.parse_arguments(sc_argc(), sc_argv())) {
+        SC_REPORT_FATAL("top", "Usage : [-i input_dir] [-l list_file] [-s index/count] [stimulus ...]");
+    }
+    if (stimulus.list_size() == 0) {
+        set_stimulus();
+    }
+    stimulus.apply_shard();
 
     env         = new       env_t("env", stimulus, time_constraint, fifo_size);
     dut_enc     = new   dut_enc_t("dut_enc");
@@ -134,6 +142,33 @@ void Top<reference_size, coding_size>::end_of_simulation() {
 #ifdef DUMP_ENV
     sc_close_vcd_trace_file(tr);
 #endif
+    report_throughput();
+}
+
+/**
+ *  DUTのスループットを表示し、dump_dir/throughput.jsonに出力する
+ */
+template <int reference_size, int coding_size>
+void Top<reference_size, coding_size>::report_throughput() {
+    string      file    = stimulus.dump_dir + "/" + "throughput.json";
+    ofstream    ofs(file.c_str());
+
+    dut_enc->get_throughput().report(cout, dut_enc->name(), stimulus.list);
+    dut_dec->get_throughput().report(cout, dut_dec->name(), stimulus.list);
+
+    if (!ofs) {
+        SC_REPORT_WARNING(name(), ("can not open " + file).c_str());
+        return;
+    }
+    ofs << "{\n"
+        << "  \"reference_size\" : " << reference_size << ",\n"
+        << "  \"coding_size\" : "    << coding_size    << ",\n"
+        << "  \"dut_enc\" : ";
+    dut_enc->get_throughput().write_json(ofs, stimulus.list, "  ");
+    ofs << ",\n"
+        << "  \"dut_dec\" : ";
+    dut_dec->get_throughput().write_json(ofs, stimulus.list, "  ");
+    ofs << "\n}\n";
 }
 
 #ifdef STIMULUS
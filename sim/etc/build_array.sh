@@ -0,0 +1,95 @@
+#!/bin/sh
+#
+#   @file   build_array.sh
+#   @brief  エンコーダアレイのRTLシミュレーション(sim/cpp/array_main.cpp)をVerilatorでビルドする
+#
+#   usage : build_array.sh [-t threads] [-r reference_size] [-c coding_size] [-b bytes_per_cycle] [-k lanes] [-s streams] [-w work_dir] [-x] [-- sim_args ...]
+#
+#   work_dir/r<reference_size>_c<coding_size>_b<bytes_per_cycle>_k<lanes>_s<streams>_t<threads>/sim_arrayを作成する。
+#   -bはレーンの1サイクルあたりの入力バイト数、-kはレーン数(dut_enc_array.vのdBytesPerCycle/dLanes)。
+#   -sは同時に入力するストリーム数(2^dIdWidth以下)。
+#   スレッド数0は--threadsを付けない(シングルスレッドの)モデルとなる。
+#   -xを指定した場合はビルド後にsim_argsで実行する。
+#
+#   @par    Copyright
+#   (C) 2012 Taichi Ishitani All Rights Reserved.
+#
+#   @author Taichi Ishitani
+#
+#   @date   0.0.00  2026/10/19  T. Ishitani     coding start
+#
+
+usage() {
+    echo "usage : $0 [-t threads] [-r reference_size] [-c coding_size] [-b bytes_per_cycle] [-k lanes] [-s streams] [-w work_dir] [-x] [-- sim_args ...]" 1>&2
+    exit 2
+}
+
+absolute_path() {
+    case "$1" in
+        /*) echo "$1" ;;
+        *)  echo "`pwd`/$1" ;;
+    esac
+}
+
+sim_dir=`dirname "$0"`/..
+sim_dir=`cd "$sim_dir" && pwd`
+rtl_dir=$sim_dir/../rtl
+
+threads=0
+reference_size=64
+coding_size=5
+bytes_per_cycle=1
+lanes=4
+streams=8
+work_dir=./build_array
+run=0
+
+while getopts t:r:c:b:k:s:w:x option; do
+    case $option in
+        t)  threads=$OPTARG ;;
+        r)  reference_size=$OPTARG ;;
+        c)  coding_size=$OPTARG ;;
+        b)  bytes_per_cycle=$OPTARG ;;
+        k)  lanes=$OPTARG ;;
+        s)  streams=$OPTARG ;;
+        w)  work_dir=$OPTARG ;;
+        x)  run=1 ;;
+        *)  usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+work_dir=`absolute_path "$work_dir"`
+jobs=`nproc 2>/dev/null || echo 1`
+dir=$work_dir/r${reference_size}_c${coding_size}_b${bytes_per_cycle}_k${lanes}_s${streams}_t${threads}
+
+#   ストリームIDの幅
+id_width=1
+max_id=2
+while [ $max_id -lt $streams ]; do
+    max_id=`expr $max_id \* 2`
+    id_width=`expr $id_width + 1`
+done
+
+if [ "$threads" -gt 0 ]; then
+    thread_option="--threads $threads"
+else
+    thread_option=
+fi
+
+echo "Build : reference_size $reference_size coding_size $coding_size bytes_per_cycle $bytes_per_cycle lanes $lanes streams $streams threads $threads"
+rm -rf "$dir"
+mkdir -p "$dir"
+verilator --cc -O3 --x-assign fast --x-initial fast --noassert \
+    -Wno-fatal -Wno-lint -Wno-style \
+    -y $rtl_dir -I$rtl_dir/include $thread_option \
+    +define+dReferenceSize=$reference_size +define+dCodingSize=$coding_size +define+dBytesPerCycle=$bytes_per_cycle +define+dLanes=$lanes +define+dIdWidth=$id_width \
+    --top-module dut_enc_array -Mdir "$dir/obj" --exe --build -j $jobs -o "$dir/sim_array" \
+    -CFLAGS "-O2 -I$sim_dir/cpp -I$sim_dir/env -I$sim_dir/../sc_model/etc -I$sim_dir/../c_model/include -DREFERENCE_SIZE=$reference_size -DCODING_SIZE=$coding_size -DBYTES_PER_CYCLE=$bytes_per_cycle -DLANES=$lanes -DSTREAMS=$streams" \
+    $sim_dir/dut/dut_enc_array.v \
+    $sim_dir/cpp/array_main.cpp || exit 1
+
+if [ $run -ne 0 ]; then
+    [ "$1" = "--" ] && shift
+    "$dir/sim_array" "$@"
+fi
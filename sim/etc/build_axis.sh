@@ -0,0 +1,84 @@
+#!/bin/sh
+#
+#   @file   build_axis.sh
+#   @brief  AXI4-StreamエンコーダのRTLシミュレーション(sim/cpp/axis_main.cpp)をVerilatorでビルドする
+#
+#   usage : build_axis.sh [-t threads] [-r reference_size] [-c coding_size] [-b bytes_per_cycle] [-a axis_bytes] [-w work_dir] [-x] [-- sim_args ...]
+#
+#   work_dir/r<reference_size>_c<coding_size>_b<bytes_per_cycle>_a<axis_bytes>_t<threads>/sim_axisを作成する。
+#   -bはエンコーダの1サイクルあたりの入力バイト数、-aはAXI4-Streamのバイト数(dut_enc_axis.vのdBytesPerCycle/dAxisBytes)。
+#   スレッド数0は--threadsを付けない(シングルスレッドの)モデルとなる。
+#   -xを指定した場合はビルド後にsim_argsで実行する。
+#
+#   @par    Copyright
+#   (C) 2012 Taichi Ishitani All Rights Reserved.
+#
+#   @author Taichi Ishitani
+#
+#   @date   0.0.00  2026/10/19  T. Ishitani     coding start
+#
+
+usage() {
+    echo "usage : $0 [-t threads] [-r reference_size] [-c coding_size] [-b bytes_per_cycle] [-a axis_bytes] [-w work_dir] [-x] [-- sim_args ...]" 1>&2
+    exit 2
+}
+
+absolute_path() {
+    case "$1" in
+        /*) echo "$1" ;;
+        *)  echo "`pwd`/$1" ;;
+    esac
+}
+
+sim_dir=`dirname "$0"`/..
+sim_dir=`cd "$sim_dir" && pwd`
+rtl_dir=$sim_dir/../rtl
+
+threads=0
+reference_size=64
+coding_size=5
+bytes_per_cycle=8
+axis_bytes=8
+work_dir=./build_axis
+run=0
+
+while getopts t:r:c:b:a:w:x option; do
+    case $option in
+        t)  threads=$OPTARG ;;
+        r)  reference_size=$OPTARG ;;
+        c)  coding_size=$OPTARG ;;
+        b)  bytes_per_cycle=$OPTARG ;;
+        a)  axis_bytes=$OPTARG ;;
+        w)  work_dir=$OPTARG ;;
+        x)  run=1 ;;
+        *)  usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+work_dir=`absolute_path "$work_dir"`
+jobs=`nproc 2>/dev/null || echo 1`
+dir=$work_dir/r${reference_size}_c${coding_size}_b${bytes_per_cycle}_a${axis_bytes}_t${threads}
+
+if [ "$threads" -gt 0 ]; then
+    thread_option="--threads $threads"
+else
+    thread_option=
+fi
+
+echo "Build : reference_size $reference_size coding_size $coding_size bytes_per_cycle $bytes_per_cycle axis_bytes $axis_bytes threads $threads"
+rm -rf "$dir"
+mkdir -p "$dir"
+verilator --cc -O3 --x-assign fast --x-initial fast --noassert \
+    -Wno-fatal -Wno-lint -Wno-style \
+    -y $rtl_dir -I$rtl_dir/include $thread_option \
+    +define+dReferenceSize=$reference_size +define+dCodingSize=$coding_size +define+dBytesPerCycle=$bytes_per_cycle +define+dAxisBytes=$axis_bytes \
+    --top-module dut_enc_axis -Mdir "$dir/obj" --exe --build -j $jobs -o "$dir/sim_axis" \
+    -CFLAGS "-O2 -I$sim_dir/cpp -I$sim_dir/env -I$sim_dir/../sc_model/etc -I$sim_dir/../c_model/include -DREFERENCE_SIZE=$reference_size -DCODING_SIZE=$coding_size -DBYTES_PER_CYCLE=$bytes_per_cycle -DAXIS_BYTES=$axis_bytes" \
+    $sim_dir/dut/dut_enc_axis.v \
+    $sim_dir/cpp/axis_main.cpp || exit 1
+
+if [ $run -ne 0 ]; then
+    [ "$1" = "--" ] && shift
+    "$dir/sim_axis" "$@"
+fi
@@ -0,0 +1,152 @@
+#!/bin/sh
+#
+#   @file   build_cpp.sh
+#   @brief  SystemCを使用しないRTLシミュレーション(sim/cpp)をVerilatorでビルドする
+#
+#   usage : build_cpp.sh [-t "threads ..."] [-r reference_size] [-c coding_size] [-b bytes_per_cycle] [-e encoder_type] [-d decoder_type] [-n decoder_bytes_per_cycle] [-l early_literals] [-p search_register_interval] [-g shift_register] [-m] [-w work_dir] [-x] [-- sim_args ...]
+#
+#   -tに指定したスレッド数ごとにwork_dir/r<reference_size>_c<coding_size>_e<encoder_type>_d<decoder_type>_n<decoder_bytes_per_cycle>_b<bytes_per_cycle>_l<early_literals>_p<search_register_interval>_g<shift_register>_m<perf_counter>_t<threads>/sim_cppを作成する。
+#   -bはエンコーダの1サイクルあたりの入力バイト数(dut_enc.vのdBytesPerCycle)。
+#   -eはエンコーダの構成(dut_enc.vのdEncoderType)。2(lzss_enc_hash_top)は-b 1のみ。
+#   -dはデコーダの構成(dut_dec.vのdDecoderType)。
+#   -nはデコーダの1サイクルあたりの最大出力バイト数(dut_dec.vのdDecoderBytesPerCycle)。
+#   -l/-pはlzss_enc_topの早期リテラル数/検索のレジスタ間隔(dut_enc.vのdEarlyLiterals/dSearchRegisterInterval)。-e 0のみ。
+#   -gはlzss_enc_shift_topのシフト数をレジスタで受ける(dut_enc.vのdShiftRegister、2サイクルで1コード)。-e 1のみ。
+#   -mはlzss_enc_top/lzss_dec_topに性能カウンタを付ける(dPerfCounter)。
+#   スレッド数0は--threadsを付けない(シングルスレッドの)モデルとなる。
+#   Vdut_decをライブラリとして先にビルドし、Vdut_encの実行ファイルにリンクする。
+#   -xを指定した場合はビルド後に各構成をsim_argsで実行し、サイクル数/秒を一覧表示する。
+#
+#   @par    Copyright
+#   (C) 2012 Taichi Ishitani All Rights Reserved.
+#
+#   @author Taichi Ishitani
+#
+#   @date   0.0.00  2026/10/19  T. Ishitani     coding start
+#
+
+usage() {
+    echo "usage : $0 [-t \"threads ...\"] [-r reference_size] [-c coding_size] [-b bytes_per_cycle] [-e encoder_type] [-d decoder_type] [-n decoder_bytes_per_cycle] [-l early_literals] [-p search_register_interval] [-g shift_register] [-m] [-w work_dir] [-x] [-- sim_args ...]" 1>&2
+    exit 2
+}
+
+absolute_path() {
+    case "$1" in
+        /*) echo "$1" ;;
+        *)  echo "`pwd`/$1" ;;
+    esac
+}
+
+sim_dir=`dirname "$0"`/..
+sim_dir=`cd "$sim_dir" && pwd`
+rtl_dir=$sim_dir/../rtl
+
+thread_list="0 `nproc 2>/dev/null || echo 1`"
+reference_size=64
+coding_size=5
+bytes_per_cycle=1
+encoder_type=0
+decoder_type=0
+decoder_bytes_per_cycle=1
+early_literals=0
+search_register_interval=1
+shift_register=0
+perf_counter=0
+work_dir=./build_cpp
+run=0
+
+while getopts t:r:c:b:e:d:n:l:p:g:mw:x option; do
+    case $option in
+        t)  thread_list=$OPTARG ;;
+        r)  reference_size=$OPTARG ;;
+        c)  coding_size=$OPTARG ;;
+        b)  bytes_per_cycle=$OPTARG ;;
+        e)  encoder_type=$OPTARG ;;
+        d)  decoder_type=$OPTARG ;;
+        n)  decoder_bytes_per_cycle=$OPTARG ;;
+        l)  early_literals=$OPTARG ;;
+        p)  search_register_interval=$OPTARG ;;
+        g)  shift_register=$OPTARG ;;
+        m)  perf_counter=1 ;;
+        w)  work_dir=$OPTARG ;;
+        x)  run=1 ;;
+        *)  usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+#   lzss_enc_hash_topの入力は1サイクル1バイト(i_keepなし)
+#   (dut_enc.vでも不正な組み合わせはillegalとして入出力を止める)
+if [ "$encoder_type" -eq 2 ] && [ "$bytes_per_cycle" -ne 1 ]; then
+    echo "$0 : encoder_type 2 supports bytes_per_cycle 1 only" 1>&2
+    exit 2
+fi
+
+#   早期リテラル/検索のレジスタ間隔はlzss_enc_top(-e 0)のみ
+#   (dut_enc.vでも不正な組み合わせはillegalとして入出力を止める)
+if [ "$encoder_type" -ne 0 ] && { [ "$early_literals" -ne 0 ] || [ "$search_register_interval" -ne 1 ]; }; then
+    echo "$0 : early_literals/search_register_interval require encoder_type 0" 1>&2
+    exit 2
+fi
+
+#   シフト数のレジスタはlzss_enc_shift_top(-e 1)のみ
+#   (dut_enc.vでも不正な組み合わせはillegalとして入出力を止める)
+if [ "$encoder_type" -ne 1 ] && [ "$shift_register" -ne 0 ]; then
+    echo "$0 : shift_register requires encoder_type 1" 1>&2
+    exit 2
+fi
+
+work_dir=`absolute_path "$work_dir"`
+jobs=`nproc 2>/dev/null || echo 1`
+
+#   Verilatorの共通オプション
+verilator_options="--cc -O3 --x-assign fast --x-initial fast --noassert
+    -Wno-fatal -Wno-lint -Wno-style
+    -y $rtl_dir -I$rtl_dir/include
+    +define+dReferenceSize=$reference_size +define+dCodingSize=$coding_size +define+dBytesPerCycle=$bytes_per_cycle +define+dEncoderType=$encoder_type +define+dDecoderType=$decoder_type +define+dDecoderBytesPerCycle=$decoder_bytes_per_cycle +define+dEarlyLiterals=$early_literals +define+dSearchRegisterInterval=$search_register_interval +define+dShiftRegister=$shift_register +define+dPerfCounter=$perf_counter"
+
+build() {
+    threads=$1
+    dir=$work_dir/r${reference_size}_c${coding_size}_e${encoder_type}_d${decoder_type}_n${decoder_bytes_per_cycle}_b${bytes_per_cycle}_l${early_literals}_p${search_register_interval}_g${shift_register}_m${perf_counter}_t${threads}
+    if [ "$threads" -gt 0 ]; then
+        thread_option="--threads $threads"
+    else
+        thread_option=
+    fi
+
+    rm -rf "$dir"
+    mkdir -p "$dir"
+
+    #   デコーダ(ライブラリ)
+    verilator $verilator_options $thread_option \
+        --top-module dut_dec -Mdir "$dir/dec" \
+        $sim_dir/dut/dut_dec.v || return 1
+    make -s -j$jobs -C "$dir/dec" -f Vdut_dec.mk Vdut_dec__ALL.a || return 1
+
+    #   エンコーダ + トップ(実行ファイル)
+    verilator $verilator_options $thread_option \
+        --top-module dut_enc -Mdir "$dir/enc" --exe --build -j $jobs -o "$dir/sim_cpp" \
+        -CFLAGS "-O2 -I$dir/dec -I$sim_dir/cpp -I$sim_dir/env -I$sim_dir/../sc_model/etc -I$sim_dir/../c_model/include -DREFERENCE_SIZE=$reference_size -DCODING_SIZE=$coding_size -DBYTES_PER_CYCLE=$bytes_per_cycle -DENCODER_TYPE=$encoder_type -DDECODER_TYPE=$decoder_type -DDECODER_BYTES_PER_CYCLE=$decoder_bytes_per_cycle -DEARLY_LITERALS=$early_literals -DSEARCH_REGISTER_INTERVAL=$search_register_interval -DSHIFT_REGISTER=$shift_register -DTHREADS=$threads" \
+        $sim_dir/dut/dut_enc.v \
+        $sim_dir/cpp/main.cpp "$dir/dec/Vdut_dec__ALL.a" || return 1
+}
+
+for threads in $thread_list; do
+    echo "Build : reference_size $reference_size coding_size $coding_size bytes_per_cycle $bytes_per_cycle encoder_type $encoder_type decoder_type $decoder_type decoder_bytes_per_cycle $decoder_bytes_per_cycle early_literals $early_literals search_register_interval $search_register_interval shift_register $shift_register perf_counter $perf_counter threads $threads"
+    build $threads || exit 1
+done
+
+#   各構成の実行
+if [ $run -ne 0 ]; then
+    [ "$1" = "--" ] && shift
+    summary=
+    for threads in $thread_list; do
+        dir=$work_dir/r${reference_size}_c${coding_size}_e${encoder_type}_d${decoder_type}_n${decoder_bytes_per_cycle}_b${bytes_per_cycle}_l${early_literals}_p${search_register_interval}_g${shift_register}_m${perf_counter}_t${threads}
+        "$dir/sim_cpp" "$@" > "$dir/log" 2>&1
+        rate=`sed -n 's/^Total Cycles\/sec *: *//p' "$dir/log"`
+        summary="$summary`printf '%-52s : %s cycles/sec' "r${reference_size}_c${coding_size}_e${encoder_type}_d${decoder_type}_n${decoder_bytes_per_cycle}_b${bytes_per_cycle}_l${early_literals}_p${search_register_interval}_g${shift_register}_m${perf_counter}_t${threads}" "$rate"`
+"
+    done
+    echo "------------------------------------------------"
+    printf "%s" "$summary"
+fi